@@ -1,4 +1,7 @@
-QT       += core gui xml sql winextras
+QT       += core gui xml sql winextras concurrent
+
+# Runtime CPU feature checks for the LaunchBox XML text kernels
+QT       += core-private
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -12,6 +15,9 @@ CONFIG += c++17
 # deprecated API in order to know how to port your code away from it.
 DEFINES += QT_DEPRECATED_WARNINGS
 
+# Declares the Windows 10 file system controls used to block clone images (checked for at runtime)
+win32: DEFINES += WINVER=0x0A00 _WIN32_WINNT=0x0A00
+
 # You can also make your code fail to compile if it uses deprecated APIs.
 # In order to do so, uncomment the following line.
 # You can also select to disable deprecated APIs only up to a certain version of Qt.
@@ -23,6 +29,7 @@ SOURCES += \
     src/import-worker.cpp \
     src/launchbox-install.cpp \
     src/launchbox-xml.cpp \
+    src/launchbox-xml-text.cpp \
     src/launchbox.cpp \
     src/main.cpp \
     src/mainwindow.cpp
@@ -33,6 +40,7 @@ HEADERS += \
     src/import-worker.h \
     src/launchbox-install.h \
     src/launchbox-xml.h \
+    src/launchbox-xml-text.h \
     src/launchbox.h \
     src/mainwindow.h \
     src/version.h
@@ -0,0 +1,19 @@
+# Shared setup for the standalone benchmark projects, mirrors the application project
+
+# Qx headers pull in widgets
+QT += core gui widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+win32: DEFINES += WINVER=0x0A00 _WIN32_WINNT=0x0A00
+
+SRC_DIR = $$PWD/../src
+INCLUDEPATH += $$SRC_DIR $$PWD/../include
+DEPENDPATH += $$SRC_DIR $$PWD/../include
+
+LIBS += Version.lib
+
+win32:CONFIG(release, debug|release): LIBS += -L$$PWD/../lib/ -lQx_static64_0-0-2-14_Qt_5-15-0
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$PWD/../lib/ -lQx_static64_0-0-2-14_Qt_5-15-0d
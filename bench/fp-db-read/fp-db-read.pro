@@ -0,0 +1,17 @@
+# Times reading every game of a Flashpoint database with each connection profile
+# Usage: fp-db-read <Flashpoint install path> [runs]
+
+include(../bench.pri)
+
+QT += sql
+
+TARGET = fp-db-read
+
+SOURCES += \
+    main.cpp \
+    $$SRC_DIR/flashpoint-install.cpp \
+    $$SRC_DIR/flashpoint.cpp
+
+HEADERS += \
+    $$SRC_DIR/flashpoint-install.h \
+    $$SRC_DIR/flashpoint.h
@@ -0,0 +1,112 @@
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <algorithm>
+#include "flashpoint-install.h"
+
+//-Constants------------------------------------------------------------------------------------------------------------
+static inline const int DEFAULT_RUNS = 5;
+static inline const FP::Install::InclusionOptions ALL_GAMES = {true, true};
+
+//-Functions------------------------------------------------------------------------------------------------------------
+QSqlError readAllGames(FP::Install& flashpointInstall, FP::Install::ConnectionProfile profile, int& gameCount)
+{
+    QSqlError queryError;
+    gameCount = 0;
+
+    // Open connection with the profile under test
+    if((queryError = flashpointInstall.openThreadDatabaseConnection(profile)).isValid())
+        return queryError;
+
+    // Same pass order as an import, the ID pass first then the full game records
+    FP::Install::DBQueryBuffer gameIDQuery;
+    if(!(queryError = flashpointInstall.queryGameIDsByPlatform(gameIDQuery, flashpointInstall.getPlatformList(), ALL_GAMES)).isValid())
+    {
+        while(gameIDQuery.result.next())
+            gameCount++;
+
+        FP::Install::DBQueryBuffer gameQuery;
+        if(!(queryError = flashpointInstall.queryGamesByPlatform(gameQuery, flashpointInstall.getPlatformList(), ALL_GAMES)).isValid())
+        {
+            while(gameQuery.result.next())
+                FP::Install::gameFromRecord(gameQuery.result);
+        }
+    }
+
+    flashpointInstall.closeThreadedDatabaseConnection();
+    return queryError;
+}
+
+qint64 median(QList<qint64> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    return samples.at(samples.size() / 2);
+}
+
+//-Entry Point----------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QStringList args = app.arguments();
+    if(args.size() < 2)
+    {
+        out << "Usage: fp-db-read <Flashpoint install path> [runs]" << Qt::endl;
+        return 1;
+    }
+
+    FP::Install::ValidityReport validity = FP::Install::checkInstallValidity(args.at(1), FP::Install::CompatLevel::Execution);
+    if(!validity.installValid)
+    {
+        out << validity.details << Qt::endl;
+        return 1;
+    }
+
+    int runs = args.size() > 2 ? args.at(2).toInt() : DEFAULT_RUNS;
+    FP::Install flashpointInstall(args.at(1));
+
+    // Platform list is needed for the queries
+    QSqlError queryError;
+    if(!(queryError = flashpointInstall.openThreadDatabaseConnection()).isValid())
+        queryError = flashpointInstall.populateAvailableItems();
+    flashpointInstall.closeThreadedDatabaseConnection();
+    if(queryError.isValid())
+    {
+        out << queryError.text() << Qt::endl;
+        return 1;
+    }
+
+    // Warm the OS file cache so neither profile pays for the first read
+    int gameCount;
+    if((queryError = readAllGames(flashpointInstall, FP::Install::ConnectionProfile::Standard, gameCount)).isValid())
+    {
+        out << queryError.text() << Qt::endl;
+        return 1;
+    }
+
+    // Alternate profiles so drift affects both equally
+    QList<qint64> standardTimes;
+    QList<qint64> bulkReadTimes;
+    QElapsedTimer timer;
+
+    for(int i = 0; i < runs; i++)
+    {
+        for(FP::Install::ConnectionProfile profile : {FP::Install::ConnectionProfile::Standard, FP::Install::ConnectionProfile::BulkRead})
+        {
+            timer.start();
+            if((queryError = readAllGames(flashpointInstall, profile, gameCount)).isValid())
+            {
+                out << queryError.text() << Qt::endl;
+                return 1;
+            }
+            (profile == FP::Install::ConnectionProfile::Standard ? standardTimes : bulkReadTimes).append(timer.elapsed());
+        }
+    }
+
+    out << "Games read: " << gameCount << Qt::endl;
+    out << "Standard (median of " << runs << "): " << median(standardTimes) << " ms" << Qt::endl;
+    out << "BulkRead (median of " << runs << "): " << median(bulkReadTimes) << " ms" << Qt::endl;
+
+    return 0;
+}
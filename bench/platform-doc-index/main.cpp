@@ -0,0 +1,137 @@
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QUuid>
+#include <QXmlStreamWriter>
+#include <algorithm>
+#include "launchbox-install.h"
+
+//-Constants------------------------------------------------------------------------------------------------------------
+static inline const int DEFAULT_GAMES = 100000;
+static inline const int DEFAULT_RUNS = 5;
+static inline const int ADD_APP_INTERVAL = 4; // One additional app for every this many games
+static inline const int OTHER_FIELD_COUNT = 40; // LaunchBox writes many fields the importer doesn't know
+static inline const QString PLATFORM_NAME = "Bench";
+static inline const QString ROOT_ELEMENT = "LaunchBox";
+
+//-Functions------------------------------------------------------------------------------------------------------------
+bool makeInstallLayout(const QString& installPath)
+{
+    // Just enough for LB::Install to accept the folder
+    QDir installDir(installPath);
+    QFile mainExe(installDir.filePath(LB::Install::MAIN_EXE_PATH));
+
+    return installDir.mkpath(LB::Install::PLATFORMS_PATH) && installDir.mkpath(LB::Install::PLAYLISTS_PATH) &&
+           mainExe.open(QFile::WriteOnly) && mainExe.setPermissions(mainExe.permissions() | QFile::ExeOwner);
+}
+
+bool writePlatformDoc(const QString& docPath, int gameCount)
+{
+    QFile docFile(docPath);
+    if(!docFile.open(QFile::WriteOnly))
+        return false;
+
+    // Written the way LaunchBox formats its docs
+    QXmlStreamWriter writer(&docFile);
+    writer.setAutoFormatting(true);
+    writer.writeStartDocument("1.0", true);
+    writer.writeStartElement(ROOT_ELEMENT);
+
+    QList<QUuid> gameIDs;
+    for(int i = 0; i < gameCount; i++)
+    {
+        QUuid gameID = QUuid::createUuid();
+        gameIDs.append(gameID);
+
+        writer.writeStartElement(LB::Xml::Element_Game::NAME);
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_APP_PATH, "FPSoftware\\Flash\\flashplayer.exe");
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_COMMAND_LINE, "http://www.example.com/games/game" + QString::number(i) + ".swf");
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_DATE_ADDED, "2020-01-01T00:00:00-05:00");
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_DATE_MODIFIED, "2020-06-01T00:00:00-05:00");
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_DEVELOPER, "Developer " + QString::number(i % 500));
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_ID, gameID.toString(QUuid::WithoutBraces));
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_NOTES, QString("A game & its \"notes\", which run on for a while. ").repeated(1 + i % 8));
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_PLATFORM, PLATFORM_NAME);
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_PUBLISHER, "Publisher " + QString::number(i % 300));
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_SOURCE, "www.example.com");
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_STATUS, "Playable");
+        writer.writeTextElement(LB::Xml::Element_Game::ELEMENT_TITLE, "Game <" + QString::number(i) + ">");
+        for(int field = 0; field < OTHER_FIELD_COUNT; field++)
+            writer.writeTextElement("OtherField" + QString::number(field), field % 2 ? "false" : "");
+        writer.writeEndElement();
+    }
+
+    for(int i = 0; i < gameCount; i += ADD_APP_INTERVAL)
+    {
+        writer.writeStartElement(LB::Xml::Element_AddApp::NAME);
+        writer.writeTextElement(LB::Xml::Element_AddApp::ELEMENT_APP_PATH, ":message:");
+        writer.writeTextElement(LB::Xml::Element_AddApp::ELEMENT_AUTORUN_BEFORE, "false");
+        writer.writeTextElement(LB::Xml::Element_AddApp::ELEMENT_COMMAND_LINE, "Loading...");
+        writer.writeTextElement(LB::Xml::Element_AddApp::ELEMENT_GAME_ID, gameIDs.at(i).toString(QUuid::WithoutBraces));
+        writer.writeTextElement(LB::Xml::Element_AddApp::ELEMENT_ID, QUuid::createUuid().toString(QUuid::WithoutBraces));
+        writer.writeTextElement(LB::Xml::Element_AddApp::ELEMENT_NAME, "Message");
+        writer.writeTextElement(LB::Xml::Element_AddApp::ELEMENT_WAIT_FOR_EXIT, "false");
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+    writer.writeEndDocument();
+    return !writer.hasError();
+}
+
+//-Entry Point----------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QStringList args = app.arguments();
+    int gameCount = args.size() > 1 ? args.at(1).toInt() : DEFAULT_GAMES;
+    int runs = args.size() > 2 ? args.at(2).toInt() : DEFAULT_RUNS;
+
+    // Generate install with one large platform doc
+    QTemporaryDir installDir;
+    if(!installDir.isValid() || !makeInstallLayout(installDir.path()))
+    {
+        out << "Could not create the install layout" << Qt::endl;
+        return 1;
+    }
+
+    QString docPath = LB::Install(installDir.path()).getPlatformDocPath(PLATFORM_NAME);
+    if(!writePlatformDoc(docPath, gameCount))
+    {
+        out << "Could not write the platform doc" << Qt::endl;
+        return 1;
+    }
+    out << "Platform doc: " << gameCount << " games, " << QFileInfo(docPath).size() / (1024 * 1024) << " MiB" << Qt::endl;
+
+    // Open the doc repeatedly, a fresh install each run so the doc isn't still leased
+    QList<qint64> openTimes;
+    QElapsedTimer timer;
+
+    for(int i = 0; i < runs + 1; i++)
+    {
+        LB::Install launchboxInstall(installDir.path());
+        launchboxInstall.populateExistingDocs({PLATFORM_NAME}, {});
+
+        std::unique_ptr<LB::Xml::PlatformDoc> platformDoc;
+        timer.start();
+        Qx::XmlStreamReaderError openError = launchboxInstall.openPlatformDoc(platformDoc, PLATFORM_NAME, {LB::NewAndExisting, false});
+        qint64 elapsed = timer.elapsed();
+
+        if(openError.isValid())
+        {
+            out << openError.getText() << Qt::endl;
+            return 1;
+        }
+
+        if(i > 0) // First run only warms the OS file cache
+            openTimes.append(elapsed);
+    }
+
+    std::sort(openTimes.begin(), openTimes.end());
+    out << "Open and index (median of " << runs << "): " << openTimes.at(openTimes.size() / 2) << " ms" << Qt::endl;
+
+    return 0;
+}
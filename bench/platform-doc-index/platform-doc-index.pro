@@ -0,0 +1,23 @@
+# Times opening (indexing) a large generated platform doc
+# Usage: platform-doc-index [games] [runs]
+
+include(../bench.pri)
+
+QT += xml core-private
+
+TARGET = platform-doc-index
+
+SOURCES += \
+    main.cpp \
+    $$SRC_DIR/flashpoint.cpp \
+    $$SRC_DIR/launchbox-install.cpp \
+    $$SRC_DIR/launchbox-xml.cpp \
+    $$SRC_DIR/launchbox-xml-text.cpp \
+    $$SRC_DIR/launchbox.cpp
+
+HEADERS += \
+    $$SRC_DIR/flashpoint.h \
+    $$SRC_DIR/launchbox-install.h \
+    $$SRC_DIR/launchbox-xml.h \
+    $$SRC_DIR/launchbox-xml-text.h \
+    $$SRC_DIR/launchbox.h
@@ -0,0 +1,211 @@
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+#include <private/qsimd_p.h>
+#include "launchbox-xml-text.h"
+
+//-Constants------------------------------------------------------------------------------------------------------------
+static inline const int CHECK_CASES = 200000;
+static inline const int CHECK_MAX_LENGTH = 160;
+static inline const int DEFAULT_ITERATIONS = 50;
+static inline const int CORPUS_SIZE = 20000;
+static inline const QString ELEMENT_NAME = "e";
+
+//-Functions------------------------------------------------------------------------------------------------------------
+QString randomText(QRandomGenerator& rng, int length, bool sparse)
+{
+    // Mostly plain text, with every class the kernels treat specially mixed in
+    static const QStringList SPECIALS = {"<", ">", "&", "\"", "'", "\t", "\n", "\r", "\r\n", QString(QChar(0x01)), QString(QChar(0x1F)),
+                                         QString(QChar(0xFFFE)), QString(QChar(0xFFFF)), QString(QChar(0xFFFD)), QString(QChar(0xFF21)),
+                                         QString(QChar(0xF000)), QString(QChar(0x3042)), QString(QChar(0xE9)), QString::fromUcs4(U"\U0001F600")};
+    QString text;
+    text.reserve(length);
+
+    while(text.size() < length)
+    {
+        if(rng.bounded(sparse ? 64 : 4) == 0)
+            text += SPECIALS.at(rng.bounded(SPECIALS.size()));
+        else
+            text += QChar(rng.bounded(0x20, 0x7F));
+    }
+
+    return text;
+}
+
+QByteArray writerEscaped(const QString& text)
+{
+    QByteArray document;
+    QXmlStreamWriter writer(&document);
+    writer.setCodec("UTF-8");
+    writer.writeStartElement(ELEMENT_NAME);
+    writer.writeCharacters(text);
+    writer.writeEndElement();
+
+    // Strip the element around the content
+    int contentStart = document.indexOf('>') + 1;
+    return document.mid(contentStart, document.lastIndexOf('<') - contentStart);
+}
+
+QString readerUnescaped(const QByteArray& rawContent, bool& valid)
+{
+    QXmlStreamReader reader("<" + ELEMENT_NAME.toUtf8() + ">" + rawContent + "</" + ELEMENT_NAME.toUtf8() + ">");
+    reader.readNextStartElement();
+    QString text = reader.readElementText();
+    valid = !reader.hasError();
+    return text;
+}
+
+QByteArray withReferences(QRandomGenerator& rng, QByteArray escaped)
+{
+    // Character references aren't produced by the escaper, add some so their decoding is covered too
+    for(int i = rng.bounded(4); i > 0; i--)
+    {
+        uint codePoint = rng.bounded(2) ? rng.bounded(0x20u, 0xD800u) : rng.bounded(0x10000u, 0x110000u);
+        QByteArray reference = rng.bounded(2) ? "&#x" + QByteArray::number(codePoint, 16) + ';' : "&#" + QByteArray::number(codePoint) + ';';
+
+        // Only insert between elements of the existing content
+        int at = rng.bounded(escaped.size() + 1);
+        while(at < escaped.size() && (escaped.at(at) & 0xC0) == 0x80)
+            at++;
+        int entityStart = at > 0 ? escaped.lastIndexOf('&', at - 1) : -1;
+        if(entityStart != -1 && escaped.indexOf(';', entityStart) >= at)
+            at = entityStart;
+
+        escaped.insert(at, reference);
+    }
+
+    return escaped;
+}
+
+int checkAgainstReference(QTextStream& out)
+{
+    QRandomGenerator rng(1);
+    int fallbacks = 0;
+
+    for(int i = 0; i < CHECK_CASES; i++)
+    {
+        QString text = randomText(rng, rng.bounded(CHECK_MAX_LENGTH), false);
+        QByteArray utf8 = text.toUtf8();
+
+        // Escaping must match QXmlStreamWriter byte for byte
+        QByteArray escaped;
+        LB::XmlText::appendEscaped(escaped, utf8.constData(), utf8.constData() + utf8.size());
+        QByteArray expectedEscaped = writerEscaped(text);
+        if(escaped != expectedEscaped)
+        {
+            out << "Escape mismatch for case " << i << ":\n  got      " << escaped.toHex() << "\n  expected " << expectedEscaped.toHex() << Qt::endl;
+            return 1;
+        }
+
+        // Unescaping must match QXmlStreamReader whenever it doesn't defer to it
+        QByteArray rawContent = withReferences(rng, escaped);
+        bool readerValid;
+        QString expectedText = readerUnescaped(rawContent, readerValid);
+        QString unescaped;
+        if(!LB::XmlText::unescape(unescaped, rawContent))
+            fallbacks++;
+        else if(!readerValid || unescaped != expectedText)
+        {
+            out << "Unescape mismatch for case " << i << ":\n  input " << rawContent.toHex() << Qt::endl;
+            return 1;
+        }
+    }
+
+    out << "Reference check passed for " << CHECK_CASES << " cases (" << fallbacks << " deferred to the stream reader)" << Qt::endl;
+    return 0;
+}
+
+void timeKernels(QTextStream& out, int iterations)
+{
+    QRandomGenerator rng(2);
+    QList<QString> corpus;
+    QList<QByteArray> utf8Corpus;
+    QList<QByteArray> escapedCorpus;
+    qint64 corpusBytes = 0;
+
+    // Field sized text with the occasional special character, as in real platform docs
+    for(int i = 0; i < CORPUS_SIZE; i++)
+    {
+        QString text = randomText(rng, rng.bounded(8, i % 16 == 0 ? 2048 : 96), true);
+        corpus.append(text);
+        utf8Corpus.append(text.toUtf8());
+        escapedCorpus.append(writerEscaped(text));
+        corpusBytes += utf8Corpus.last().size();
+    }
+
+    QElapsedTimer timer;
+    auto report = [&](const char* label, qint64 nanoseconds){
+        double megabytesPerSecond = double(corpusBytes) * iterations / (double(nanoseconds) / 1e9) / (1024 * 1024);
+        out << label << ": " << QString::number(megabytesPerSecond, 'f', 1) << " MiB/s" << Qt::endl;
+    };
+
+    // Escaping
+    QByteArray buffer;
+    timer.start();
+    for(int i = 0; i < iterations; i++)
+    {
+        for(const QByteArray& utf8 : qAsConst(utf8Corpus))
+        {
+            buffer.resize(0);
+            LB::XmlText::appendEscaped(buffer, utf8.constData(), utf8.constData() + utf8.size());
+        }
+    }
+    report("XmlText::appendEscaped        ", timer.nsecsElapsed());
+
+    timer.start();
+    for(int i = 0; i < iterations; i++)
+    {
+        buffer.resize(0);
+        QXmlStreamWriter writer(&buffer);
+        writer.setCodec("UTF-8");
+        writer.writeStartElement(ELEMENT_NAME);
+        for(const QString& text : qAsConst(corpus))
+            writer.writeCharacters(text);
+        writer.writeEndElement();
+    }
+    report("QXmlStreamWriter::writeCharacters", timer.nsecsElapsed());
+
+    // Unescaping
+    QString text;
+    timer.start();
+    for(int i = 0; i < iterations; i++)
+    {
+        for(const QByteArray& rawContent : qAsConst(escapedCorpus))
+            LB::XmlText::unescape(text, rawContent);
+    }
+    report("XmlText::unescape             ", timer.nsecsElapsed());
+
+    bool valid;
+    timer.start();
+    for(int i = 0; i < iterations; i++)
+    {
+        for(const QByteArray& rawContent : qAsConst(escapedCorpus))
+            text = readerUnescaped(rawContent, valid);
+    }
+    report("QXmlStreamReader::readElementText", timer.nsecsElapsed());
+}
+
+//-Entry Point----------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QStringList args = app.arguments();
+    int iterations = args.size() > 1 ? args.at(1).toInt() : DEFAULT_ITERATIONS;
+
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    out << "AVX2 path: " << (qCpuHasFeature(AVX2) ? "used" : "not supported by this CPU") << Qt::endl;
+#else
+    out << "AVX2 path: not built" << Qt::endl;
+#endif
+
+    if(checkAgainstReference(out) != 0)
+        return 1;
+
+    timeKernels(out, iterations);
+    return 0;
+}
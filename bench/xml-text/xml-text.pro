@@ -0,0 +1,15 @@
+# Checks the LaunchBox XML text kernels against QXmlStreamWriter/QXmlStreamReader with random input, then times them
+# Usage: xml-text [iterations]
+
+include(../bench.pri)
+
+QT += xml core-private
+
+TARGET = xml-text
+
+SOURCES += \
+    main.cpp \
+    $$SRC_DIR/launchbox-xml-text.cpp
+
+HEADERS += \
+    $$SRC_DIR/launchbox-xml-text.h
@@ -320,6 +320,12 @@ QString Install::CLIFp::parametersFromStandard(QString originalAppPath, QString
 //Public:
 Install::Install(QString installPath)
 {
+    // Ensure record decoding by position matches the column lists
+    Q_ASSERT(DBTable_Game::IDX_COUNT == DBTable_Game::COLUMN_LIST.size());
+    Q_ASSERT(DBTable_Add_App::IDX_COUNT == DBTable_Add_App::COLUMN_LIST.size());
+    Q_ASSERT(DBTable_Playlist::IDX_COUNT == DBTable_Playlist::COLUMN_LIST.size());
+    Q_ASSERT(DBTable_Playlist_Game::IDX_COUNT == DBTable_Playlist_Game::COLUMN_LIST.size());
+
     // Ensure instance will be at least minimally compatible
     if(!checkInstallValidity(installPath, CompatLevel::Execution).installValid)
         assert("Cannot create a Install instance with an invalid installPath. Check first with Install::checkInstallValidity(QString, CompatLevel).");
@@ -401,6 +407,74 @@ Install::ValidityReport Install::checkInstallValidity(QString installPath, Compa
     return ValidityReport{true, QString()};
 }
 
+Game Install::gameFromRecord(const QSqlQuery& record)
+{
+    // Read fields by position to avoid per-field name lookups
+    GameBuilder fpGb;
+    fpGb.wID(record.value(DBTable_Game::IDX_ID).toString());
+    fpGb.wTitle(record.value(DBTable_Game::IDX_TITLE).toString());
+    fpGb.wSeries(record.value(DBTable_Game::IDX_SERIES).toString());
+    fpGb.wDeveloper(record.value(DBTable_Game::IDX_DEVELOPER).toString());
+    fpGb.wPublisher(record.value(DBTable_Game::IDX_PUBLISHER).toString());
+    fpGb.wDateAdded(record.value(DBTable_Game::IDX_DATE_ADDED).toString());
+    fpGb.wDateModified(record.value(DBTable_Game::IDX_DATE_MODIFIED).toString());
+    fpGb.wPlatform(record.value(DBTable_Game::IDX_PLATFORM).toString());
+    fpGb.wBroken(record.value(DBTable_Game::IDX_BROKEN).toString());
+    fpGb.wPlayMode(record.value(DBTable_Game::IDX_PLAY_MODE).toString());
+    fpGb.wStatus(record.value(DBTable_Game::IDX_STATUS).toString());
+    fpGb.wNotes(record.value(DBTable_Game::IDX_NOTES).toString());
+    fpGb.wSource(record.value(DBTable_Game::IDX_SOURCE).toString());
+    fpGb.wAppPath(record.value(DBTable_Game::IDX_APP_PATH).toString());
+    fpGb.wLaunchCommand(record.value(DBTable_Game::IDX_LAUNCH_COMMAND).toString());
+    fpGb.wReleaseDate(record.value(DBTable_Game::IDX_RELEASE_DATE).toString());
+    fpGb.wVersion(record.value(DBTable_Game::IDX_VERSION).toString());
+    fpGb.wOriginalDescription(record.value(DBTable_Game::IDX_ORIGINAL_DESC).toString());
+    fpGb.wLanguage(record.value(DBTable_Game::IDX_LANGUAGE).toString());
+    fpGb.wOrderTitle(record.value(DBTable_Game::IDX_ORDER_TITLE).toString());
+    fpGb.wLibrary(record.value(DBTable_Game::IDX_LIBRARY).toString());
+
+    return fpGb.build();
+}
+
+AddApp Install::addAppFromRecord(const QSqlQuery& record)
+{
+    // Read fields by position to avoid per-field name lookups
+    AddAppBuilder fpAab;
+    fpAab.wID(record.value(DBTable_Add_App::IDX_ID).toString());
+    fpAab.wAppPath(record.value(DBTable_Add_App::IDX_APP_PATH).toString());
+    fpAab.wAutorunBefore(record.value(DBTable_Add_App::IDX_AUTORUN).toString());
+    fpAab.wLaunchCommand(record.value(DBTable_Add_App::IDX_LAUNCH_COMMAND).toString());
+    fpAab.wName(record.value(DBTable_Add_App::IDX_NAME).toString());
+    fpAab.wWaitExit(record.value(DBTable_Add_App::IDX_WAIT_EXIT).toString());
+    fpAab.wParentID(record.value(DBTable_Add_App::IDX_PARENT_ID).toString());
+
+    return fpAab.build();
+}
+
+Playlist Install::playlistFromRecord(const QSqlQuery& record)
+{
+    // Read fields by position to avoid per-field name lookups
+    PlaylistBuilder fpPb;
+    fpPb.wID(record.value(DBTable_Playlist::IDX_ID).toString());
+    fpPb.wTitle(record.value(DBTable_Playlist::IDX_TITLE).toString());
+    fpPb.wDescription(record.value(DBTable_Playlist::IDX_DESCRIPTION).toString());
+    fpPb.wAuthor(record.value(DBTable_Playlist::IDX_AUTHOR).toString());
+
+    return fpPb.build();
+}
+
+PlaylistGame Install::playlistGameFromRecord(const QSqlQuery& record)
+{
+    // Read fields by position to avoid per-field name lookups
+    PlaylistGameBuilder fpPgb;
+    fpPgb.wID(record.value(DBTable_Playlist_Game::IDX_ID).toString());
+    fpPgb.wPlaylistID(record.value(DBTable_Playlist_Game::IDX_PLAYLIST_ID).toString());
+    fpPgb.wOrder(record.value(DBTable_Playlist_Game::IDX_ORDER).toString());
+    fpPgb.wGameID(record.value(DBTable_Playlist_Game::IDX_GAME_ID).toString());
+
+    return fpPgb.build();
+}
+
 //-Instance Functions------------------------------------------------------------------------------------------------
 //Private:
 QSqlDatabase Install::getThreadedDatabaseConnection() const
@@ -412,35 +486,77 @@ QSqlDatabase Install::getThreadedDatabaseConnection() const
     else
     {
         QSqlDatabase fpDB = QSqlDatabase::addDatabase("QSQLITE", threadedName);
-        fpDB.setConnectOptions("QSQLITE_OPEN_READONLY");
+        fpDB.setConnectOptions(CONNECT_OPTIONS_STANDARD);
         fpDB.setDatabaseName(mDatabaseFile->fileName());
         return fpDB;
     }
 }
 
-QSqlError Install::makeNonBindQuery(DBQueryBuffer& resultBuffer, QSqlDatabase* database, QString queryCommand, QString sizeQueryCommand) const
+QSqlError Install::makeNonBindQuery(DBQueryBuffer& resultBuffer, QSqlDatabase* database, QString queryCommand, bool measureSize) const
 {
     // Create main query
     QSqlQuery mainQuery(*database);
-    mainQuery.setForwardOnly(true);
+    mainQuery.setForwardOnly(!measureSize);
     mainQuery.prepare(queryCommand);
 
     // Execute query and return if error occurs
     if(!mainQuery.exec())
         return mainQuery.lastError();
 
-    // Create size query
-    QSqlQuery sizeQuery(*database);
-    sizeQuery.setForwardOnly(true);
-    sizeQuery.prepare(sizeQueryCommand);
+    // Measure size from the fetched rows if requested, instead of re-running the query as a count
+    int querySize = -1;
+    if(measureSize)
+    {
+        querySize = mainQuery.last() ? mainQuery.at() + 1 : 0;
+        mainQuery.seek(QSql::BeforeFirstRow);
+    }
+
+    // Set buffer instance to result
+    resultBuffer.result = mainQuery;
+    resultBuffer.size = querySize;
+
+    // Return invalid SqlError
+    return QSqlError();
+}
+
+QSqlError Install::makeCachedBindQuery(DBQueryBuffer& resultBuffer, QSqlDatabase* database, QString queryCommand, const QVariantList& bindValues,
+                                       bool measureSize) const
+{
+    // Get this connection's prepared form of the query, preparing it again if unseen or its last result is still in use
+    QSqlQuery mainQuery;
+    {
+        QMutexLocker cacheLocker(&mPreparedQueryCacheMutex);
+        QHash<QString, QSqlQuery>& connectionCache = mPreparedQueryCache[database->connectionName()];
+
+        QHash<QString, QSqlQuery>::const_iterator cached = connectionCache.constFind(queryCommand);
+        if(cached != connectionCache.constEnd() && !cached->isActive())
+            mainQuery = cached.value();
+        else
+        {
+            mainQuery = QSqlQuery(*database);
+            mainQuery.setForwardOnly(!measureSize);
+            if(!mainQuery.prepare(queryCommand))
+                return mainQuery.lastError();
+
+            connectionCache.insert(queryCommand, mainQuery);
+        }
+    }
+
+    // Bind values for this lookup
+    for(int i = 0; i < bindValues.size(); i++)
+        mainQuery.bindValue(i, bindValues.at(i));
 
     // Execute query and return if error occurs
-    if(!sizeQuery.exec())
-        return sizeQuery.lastError();
+    if(!mainQuery.exec())
+        return mainQuery.lastError();
 
-    // Get query size
-    sizeQuery.next();
-    int querySize = sizeQuery.value(0).toInt();
+    // Measure size from the fetched rows if requested
+    int querySize = -1;
+    if(measureSize)
+    {
+        querySize = mainQuery.last() ? mainQuery.at() + 1 : 0;
+        mainQuery.seek(QSql::BeforeFirstRow);
+    }
 
     // Set buffer instance to result
     resultBuffer.result = mainQuery;
@@ -450,6 +566,22 @@ QSqlError Install::makeNonBindQuery(DBQueryBuffer& resultBuffer, QSqlDatabase* d
     return QSqlError();
 }
 
+QString Install::makeGameFilterCommand(InclusionOptions inclusionOptions, bool useIDFilter) const
+{
+    // Library filter
+    QString filterCommand = inclusionOptions.includeAnimations ? GAME_AND_ANIM_FILTER : GAME_ONLY_FILTER;
+
+    // Extreme filter
+    if(!inclusionOptions.includeExtreme)
+        filterCommand += " AND " + DBTable_Game::COL_EXTREME + " = '0'";
+
+    // ID filter, joined against the connection-local table instead of inlining the IDs
+    if(useIDFilter)
+        filterCommand += " AND " + DBTable_Game::COL_ID + " IN (SELECT " + DBTable_Game::COL_ID + " FROM " + TEMP_GAME_ID_FILTER_TABLE + ")";
+
+    return filterCommand;
+}
+
 //Public:
 bool Install::matchesTargetVersion() const
 {    
@@ -490,17 +622,48 @@ Qx::MMRB Install::currentCLIFpVersion() const
         return Qx::getFileDetails(mCLIFpEXEFile->fileName()).getFileVersion();
 }
 
-QSqlError Install::openThreadDatabaseConnection()
+QSqlError Install::openThreadDatabaseConnection(ConnectionProfile profile)
 {
     QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
-    if(fpDB.open())
-        return QSqlError(); // Empty error on success
-    else
+    // Drop prepared statements from any previous session on this connection
+    mPreparedQueryCacheMutex.lock();
+    mPreparedQueryCache.remove(fpDB.connectionName());
+    mPreparedQueryCacheMutex.unlock();
+
+    // Open read-only, Flashpoint may still write to the database while it is being read
+    if(!fpDB.open())
         return fpDB.lastError(); // Open error on fail
+
+    // Tune connection for large sequential scans
+    if(profile == ConnectionProfile::BulkRead)
+    {
+        QSqlQuery pragmaQuery(fpDB);
+        for(const QString& pragma : BULK_READ_PRAGMAS)
+        {
+            if(!pragmaQuery.exec(pragma))
+            {
+                QSqlError pragmaError = pragmaQuery.lastError();
+                fpDB.close();
+                return pragmaError;
+            }
+        }
+    }
+
+    return QSqlError(); // Empty error on success
 }
 
-void Install::closeThreadedDatabaseConnection() { getThreadedDatabaseConnection().close(); }
+void Install::closeThreadedDatabaseConnection()
+{
+    QSqlDatabase fpDB = getThreadedDatabaseConnection();
+
+    // Release this connection's prepared statements before closing it
+    mPreparedQueryCacheMutex.lock();
+    mPreparedQueryCache.remove(fpDB.connectionName());
+    mPreparedQueryCacheMutex.unlock();
+
+    fpDB.close();
+}
 
 bool Install::databaseConnectionOpenInThisThread() { return getThreadedDatabaseConnection().isOpen(); }
 
@@ -662,84 +825,150 @@ bool Install::deployCLIFp(QString& errorMessage)
 
 }
 
-QSqlError Install::queryGamesByPlatform(QList<DBQueryBuffer>& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
-                                        const QList<QUuid>& idFilter) const
+QSqlError Install::queryGameCountsByPlatform(QHash<QString, int>& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
+                                             bool useIDFilter) const
 {
     // Ensure return buffer is reset
     resultBuffer.clear();
 
+    // Naturally return empty set if no platforms are selected
+    if(platforms.isEmpty())
+        return QSqlError();
+
     // Get database
     QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
-    for(const QString& platform : platforms) // Naturally returns empty list if no platforms are selected
-    {
-        // Create platform query string
-        QString placeholder = ":platform";
-        QString baseQueryCommand = "SELECT %1 FROM " + DBTable_Game::NAME + " WHERE " +
-                DBTable_Game::COL_PLATFORM + " = " + placeholder + " AND ";
+    // Count games for all platforms at once
+    QString placeHolders = QString("?,").repeated(platforms.size());
+    placeHolders.chop(1); // Remove trailing ?
+    QString countQueryCommand = "SELECT `" + DBTable_Game::COL_PLATFORM + "`, " + GENERAL_QUERY_SIZE_COMMAND + " FROM " + DBTable_Game::NAME +
+                                " WHERE " + DBTable_Game::COL_PLATFORM + " IN (" + placeHolders + ") AND " +
+                                makeGameFilterCommand(inclusionOptions, useIDFilter) + " GROUP BY " + DBTable_Game::COL_PLATFORM;
 
-        // Handle filtering
-        QString filteredQueryCommand = baseQueryCommand.append(inclusionOptions.includeAnimations ? GAME_AND_ANIM_FILTER : GAME_ONLY_FILTER);
+    QSqlQuery countQuery(fpDB);
+    countQuery.setForwardOnly(true);
+    countQuery.prepare(countQueryCommand);
+    for(const QString& platform : platforms)
+        countQuery.addBindValue(platform);
 
-        if(!inclusionOptions.includeExtreme)
-            filteredQueryCommand += " AND " + DBTable_Game::COL_EXTREME + " = '0'";
+    // Execute query and return if error occurs
+    if(!countQuery.exec())
+        return countQuery.lastError();
 
-        if(!idFilter.isEmpty())
-        {
-            QString idCSV = Qx::String::join(idFilter, "','", [](QUuid id){return id.toString(QUuid::WithoutBraces);});
-            filteredQueryCommand += " AND " + DBTable_Game::COL_ID + " IN('" + idCSV + "')";
-        }
+    // Record platform sizes
+    while(countQuery.next())
+        resultBuffer[countQuery.value(0).toString()] = countQuery.value(1).toInt();
 
-        QString mainQueryCommand = filteredQueryCommand.arg("`" + DBTable_Game::COLUMN_LIST.join("`,`") + "`");
-        QString sizeQueryCommand = filteredQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
+    // Return read error if present
+    return countQuery.lastError();
+}
 
-        // Create main query and bind current platform
-        QSqlQuery initialQuery(fpDB);
-        initialQuery.setForwardOnly(true);
-        initialQuery.prepare(mainQueryCommand);
-        initialQuery.bindValue(placeholder, platform);
+QSqlError Install::queryGameIDsByPlatform(DBQueryBuffer& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
+                                          bool useIDFilter) const
+{
+    // Ensure return buffer is effectively null
+    resultBuffer = DBQueryBuffer();
+    resultBuffer.source = DBTable_Game::NAME;
 
-        // Execute query and return if error occurs
-        if(!initialQuery.exec())
-            return initialQuery.lastError();
+    // Naturally return empty result if no platforms are selected
+    if(platforms.isEmpty())
+        return QSqlError();
 
-        // Create size query and bind current platform
-        QSqlQuery sizeQuery(fpDB);
-        sizeQuery.prepare(sizeQueryCommand);
-        sizeQuery.bindValue(placeholder, platform);
+    // Get database
+    QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
-        // Execute query and return if error occurs
-        if(!sizeQuery.exec())
-            return sizeQuery.lastError();
+    // Create query string for all platforms, grouped so that each platform's games are contiguous
+    QString placeHolders = QString("?,").repeated(platforms.size());
+    placeHolders.chop(1); // Remove trailing ?
+    QString mainQueryCommand = "SELECT `" + DBTable_Game::COL_ID + "`,`" + DBTable_Game::COL_PLATFORM + "`,`" + DBTable_Game::COL_DATE_MODIFIED +
+            "` FROM " + DBTable_Game::NAME + " WHERE " + DBTable_Game::COL_PLATFORM + " IN (" + placeHolders + ") AND " +
+            makeGameFilterCommand(inclusionOptions, useIDFilter) + " ORDER BY " + DBTable_Game::COL_PLATFORM;
 
-        // Get query size
-        sizeQuery.next();
-        int querySize = sizeQuery.value(0).toInt();
+    // Create main query and bind selected platforms
+    QSqlQuery mainQuery(fpDB);
+    mainQuery.setForwardOnly(true);
+    mainQuery.prepare(mainQueryCommand);
+    for(const QString& platform : platforms)
+        mainQuery.addBindValue(platform);
 
-        // Add result to buffer if there were any hits
-        if(querySize > 0)
-            resultBuffer.append({platform, initialQuery, querySize});
-    }
+    // Execute query and return if error occurs
+    if(!mainQuery.exec())
+        return mainQuery.lastError();
+
+    // Set buffer instance to result
+    resultBuffer.result = mainQuery;
 
     // Return invalid SqlError
     return QSqlError();
 }
 
-QSqlError Install::queryAllAddApps(DBQueryBuffer& resultBuffer) const
+QSqlError Install::queryGamesByPlatform(DBQueryBuffer& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
+                                        bool useIDFilter, QString modifiedAfter) const
 {
     // Ensure return buffer is effectively null
     resultBuffer = DBQueryBuffer();
+    resultBuffer.source = DBTable_Game::NAME;
+
+    // Naturally return empty result if no platforms are selected
+    if(platforms.isEmpty())
+        return QSqlError();
 
     // Get database
     QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
-    // Make query
-    QString baseQueryCommand = "SELECT %1 FROM " + DBTable_Add_App::NAME;
-    QString mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Add_App::COLUMN_LIST.join("`,`") + "`");
-    QString sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
+    // Create query string for all platforms, grouped so that each platform's games are contiguous
+    QString placeHolders = QString("?,").repeated(platforms.size());
+    placeHolders.chop(1); // Remove trailing ?
+    QString mainQueryCommand = "SELECT `" + DBTable_Game::COLUMN_LIST.join("`,`") + "` FROM " + DBTable_Game::NAME + " WHERE " +
+            DBTable_Game::COL_PLATFORM + " IN (" + placeHolders + ") AND " + makeGameFilterCommand(inclusionOptions, useIDFilter);
+    if(!modifiedAfter.isNull())
+        mainQueryCommand += " AND " + DBTable_Game::COL_DATE_MODIFIED + " > ?"; // Compared as stored, like the caller compares it
+    mainQueryCommand += " ORDER BY " + DBTable_Game::COL_PLATFORM;
+
+    // Create main query and bind selected platforms
+    QSqlQuery mainQuery(fpDB);
+    mainQuery.setForwardOnly(true);
+    mainQuery.prepare(mainQueryCommand);
+    for(const QString& platform : platforms)
+        mainQuery.addBindValue(platform);
+    if(!modifiedAfter.isNull())
+        mainQuery.addBindValue(modifiedAfter);
 
-    resultBuffer.source = DBTable_Add_App::NAME;
-    return makeNonBindQuery(resultBuffer, &fpDB, mainQueryCommand, sizeQueryCommand);
+    // Execute query and return if error occurs
+    if(!mainQuery.exec())
+        return mainQuery.lastError();
+
+    // Set buffer instance to result
+    resultBuffer.result = mainQuery;
+
+    // Return invalid SqlError
+    return QSqlError();
+}
+
+QSqlError Install::queryAddAppsByPlatform(DBQueryBuffer& resultBuffer, QString platform, InclusionOptions inclusionOptions,
+                                          bool useIDFilter, QString modifiedAfter) const
+{
+    // Ensure return buffer is effectively null
+    resultBuffer = DBQueryBuffer();
+
+    // Get database
+    QSqlDatabase fpDB = getThreadedDatabaseConnection();
+
+    // Create platform query string, joined against the same game filter used by queryGamesByPlatform()
+    QString mainQueryCommand = "SELECT `" + DBTable_Add_App::COLUMN_LIST.join("`,`") + "` FROM " + DBTable_Add_App::NAME + " WHERE " +
+            DBTable_Add_App::COL_PARENT_ID + " IN (SELECT " + DBTable_Game::COL_ID + " FROM " + DBTable_Game::NAME + " WHERE " +
+            DBTable_Game::COL_PLATFORM + " = ? AND " + makeGameFilterCommand(inclusionOptions, useIDFilter);
+    QVariantList bindValues = {platform};
+    if(!modifiedAfter.isNull())
+    {
+        mainQueryCommand += " AND " + DBTable_Game::COL_DATE_MODIFIED + " > ?";
+        bindValues.append(modifiedAfter);
+    }
+    mainQueryCommand += ")";
+
+    // Make query, the statement is shared by every platform
+    resultBuffer.source = platform;
+    return makeCachedBindQuery(resultBuffer, &fpDB, mainQueryCommand, bindValues);
 }
 
 QSqlError Install::queryPlaylistsByName(DBQueryBuffer& resultBuffer, QStringList playlists) const
@@ -749,7 +978,7 @@ QSqlError Install::queryPlaylistsByName(DBQueryBuffer& resultBuffer, QStringList
     {
         resultBuffer.source = QString();
         resultBuffer.result = QSqlQuery();
-        resultBuffer.size = 0;
+        resultBuffer.size = -1;
 
         return QSqlError();
     }
@@ -764,11 +993,9 @@ QSqlError Install::queryPlaylistsByName(DBQueryBuffer& resultBuffer, QStringList
         // Create selected playlists query string
         QString placeHolders = QString("?,").repeated(playlists.size());
         placeHolders.chop(1); // Remove trailing ?
-        QString baseQueryCommand = "SELECT %1 FROM " + DBTable_Playlist::NAME + " WHERE " +
+        QString mainQueryCommand = "SELECT `" + DBTable_Playlist::COLUMN_LIST.join("`,`") + "` FROM " + DBTable_Playlist::NAME + " WHERE " +
                 DBTable_Playlist::COL_TITLE + " IN (" + placeHolders + ") AND " +
                 DBTable_Playlist::COL_LIBRARY + " = '" + DBTable_Playlist::ENTRY_GAME_LIBRARY + "'";
-        QString mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Playlist::COLUMN_LIST.join("`,`") + "`");
-        QString sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
 
         // Create main query and bind selected playlists
         QSqlQuery mainQuery(fpDB);
@@ -781,25 +1008,9 @@ QSqlError Install::queryPlaylistsByName(DBQueryBuffer& resultBuffer, QStringList
         if(!mainQuery.exec())
             return mainQuery.lastError();
 
-        // Create size query and bind selected playlists
-        QSqlQuery sizeQuery(fpDB);
-        sizeQuery.setForwardOnly(true);
-        sizeQuery.prepare(sizeQueryCommand);
-        for(const QString& playlist : playlists)
-            sizeQuery.addBindValue(playlist);
-
-        // Execute query and return if error occurs
-        if(!sizeQuery.exec())
-            return sizeQuery.lastError();
-
-        // Get query size
-        sizeQuery.next();
-        int querySize = sizeQuery.value(0).toInt();
-
         // Set buffer instance to result
         resultBuffer.source = DBTable_Playlist::NAME;
         resultBuffer.result = mainQuery;
-        resultBuffer.size = querySize;
 
         // Return invalid SqlError
         return QSqlError();
@@ -811,61 +1022,94 @@ QSqlError Install::queryPlaylistGamesByPlaylist(QList<DBQueryBuffer>& resultBuff
     // Ensure return buffer is empty
     resultBuffer.clear();
 
+    // Naturally return empty list if no playlists are selected
+    if(playlistIDs.isEmpty())
+        return QSqlError();
+
     // Get database
     QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
-    for(QUuid playlistID : playlistIDs) // Naturally returns empty list if no playlists are selected
+    // Count games for all playlists at once
+    QString idCSV = Qx::String::join(playlistIDs, "','", [](QUuid id){return id.toString(QUuid::WithoutBraces);});
+    QString countQueryCommand = "SELECT `" + DBTable_Playlist_Game::COL_PLAYLIST_ID + "`, " + GENERAL_QUERY_SIZE_COMMAND + " FROM " +
+                                DBTable_Playlist_Game::NAME + " WHERE " + DBTable_Playlist_Game::COL_PLAYLIST_ID + " IN('" + idCSV + "')" +
+                                " GROUP BY " + DBTable_Playlist_Game::COL_PLAYLIST_ID;
+
+    QSqlQuery countQuery(fpDB);
+    countQuery.setForwardOnly(true);
+
+    // Execute query and return if error occurs
+    if(!countQuery.exec(countQueryCommand))
+        return countQuery.lastError();
+
+    // Record playlist sizes
+    QHash<QUuid, int> playlistSizes;
+    while(countQuery.next())
+        playlistSizes[QUuid(countQuery.value(0).toString())] = countQuery.value(1).toInt();
+
+    for(QUuid playlistID : playlistIDs)
     {
+        // Skip playlists without any hits
+        int querySize = playlistSizes.value(playlistID);
+        if(querySize <= 0)
+            continue;
+
         // Query all games for the current playlist
-        QString baseQueryCommand = "SELECT %1 FROM " + DBTable_Playlist_Game::NAME + " WHERE " +
+        QString mainQueryCommand = "SELECT `" + DBTable_Playlist_Game::COLUMN_LIST.join("`,`") + "` FROM " + DBTable_Playlist_Game::NAME + " WHERE " +
                 DBTable_Playlist_Game::COL_PLAYLIST_ID + " = '" + playlistID.toString(QUuid::WithoutBraces) + "'";
-        QString mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Playlist_Game::COLUMN_LIST.join("`,`") + "`");
-        QString sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
 
         // Make query
         QSqlError queryError;
         DBQueryBuffer queryResult;
         queryResult.source = playlistID.toString();
 
-        if((queryError = makeNonBindQuery(queryResult, &fpDB, mainQueryCommand, sizeQueryCommand)).isValid())
+        if((queryError = makeNonBindQuery(queryResult, &fpDB, mainQueryCommand)).isValid())
             return queryError;
 
-        // Add result to buffer if there were any hits
-        if(queryResult.size > 0)
-            resultBuffer.append(queryResult);
+        // Add result to buffer
+        queryResult.size = querySize;
+        resultBuffer.append(queryResult);
     }
 
     // Return invalid SqlError
     return QSqlError();
 }
 
-QSqlError Install::queryPlaylistGameIDs(DBQueryBuffer& resultBuffer, const QList<QUuid>& playlistIDs) const
+QSqlError Install::loadPlaylistGameIDFilter(const QList<QUuid>& playlistIDs) const
 {
-    // Ensure return buffer is empty
-    resultBuffer = DBQueryBuffer();
-
     // Get database
     QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
-    // Create playlist ID query string
-    QString idCSV = Qx::String::join(playlistIDs, "','", [](QUuid id){return id.toString(QUuid::WithoutBraces);});
+    QSqlQuery filterQuery(fpDB);
 
-    // Query all game IDs that fall under given the playlists
-    QString baseQueryCommand = "SELECT %1 FROM " + DBTable_Playlist_Game::NAME + " WHERE " +
-            DBTable_Playlist_Game::COL_PLAYLIST_ID + " IN('" + idCSV + "')";
-    QString mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Playlist_Game::COL_GAME_ID + "`");
-    QString sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
+    // Create filter table (temporary tables are allowed on a read-only connection and are private to it)
+    if(!filterQuery.exec("CREATE TEMP TABLE IF NOT EXISTS " + TEMP_GAME_ID_FILTER_TABLE + " (" + DBTable_Game::COL_ID + " TEXT PRIMARY KEY)"))
+        return filterQuery.lastError();
 
-    // Make query
-    QSqlError queryError;
-    resultBuffer.source = DBTable_Playlist_Game::NAME;
+    // Clear previous filter
+    if(!filterQuery.exec("DELETE FROM " + TEMP_GAME_ID_FILTER_TABLE))
+        return filterQuery.lastError();
 
-    if((queryError = makeNonBindQuery(resultBuffer, &fpDB, mainQueryCommand, sizeQueryCommand)).isValid())
-        return queryError;
+    // Naturally leave filter empty if no playlists are selected
+    if(playlistIDs.isEmpty())
+        return QSqlError();
+
+    // Fill filter with all game IDs that fall under the given playlists without round-tripping them through the application
+    QString placeHolders = QString("?,").repeated(playlistIDs.size());
+    placeHolders.chop(1); // Remove trailing ?
+    QString fillCommand = "INSERT OR IGNORE INTO " + TEMP_GAME_ID_FILTER_TABLE + " SELECT `" + DBTable_Playlist_Game::COL_GAME_ID + "` FROM " +
+            DBTable_Playlist_Game::NAME + " WHERE " + DBTable_Playlist_Game::COL_PLAYLIST_ID + " IN (" + placeHolders + ")";
+
+    filterQuery.prepare(fillCommand);
+    for(QUuid playlistID : playlistIDs)
+        filterQuery.addBindValue(playlistID.toString(QUuid::WithoutBraces));
+
+    // Execute query and return if error occurs
+    if(!filterQuery.exec())
+        return filterQuery.lastError();
 
     // Return invalid SqlError
     return QSqlError();
-
 }
 
 QSqlError Install::queryEntryByID(DBQueryBuffer& resultBuffer, QUuid appID) const
@@ -877,31 +1121,31 @@ QSqlError Install::queryEntryByID(DBQueryBuffer& resultBuffer, QUuid appID) cons
     QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
     // Check for entry as a game first
-    QString baseQueryCommand = "SELECT %1 FROM " + DBTable_Game::NAME + " WHERE " +
-            DBTable_Game::COL_ID + " == '" + appID.toString(QUuid::WithoutBraces) + "'";
-    QString mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Game::COLUMN_LIST.join("`,`") + "`");
-    QString sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
+    QString appIDString = appID.toString(QUuid::WithoutBraces);
+    QString mainQueryCommand = "SELECT `" + DBTable_Game::COLUMN_LIST.join("`,`") + "` FROM " + DBTable_Game::NAME + " WHERE " +
+            DBTable_Game::COL_ID + " == ?";
 
     // Make query
     QSqlError queryError;
     resultBuffer.source = DBTable_Game::NAME;
 
-    if((queryError = makeNonBindQuery(resultBuffer, &fpDB, mainQueryCommand, sizeQueryCommand)).isValid())
+    if((queryError = makeCachedBindQuery(resultBuffer, &fpDB, mainQueryCommand, {appIDString}, true)).isValid())
         return queryError;
 
     // Return result if one or more result were found (reciever handles situation in latter case)
     if(resultBuffer.size >= 1)
         return QSqlError();
 
+    // Release the game lookup for reuse
+    resultBuffer.result.finish();
+
     // Check for entry as an additional app second
-    baseQueryCommand = "SELECT %1 FROM " + DBTable_Add_App::NAME + " WHERE " +
-        DBTable_Add_App::COL_ID + " == '" + appID.toString(QUuid::WithoutBraces) + "'";
-    mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Add_App::COLUMN_LIST.join("`,`") + "`");
-    sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
+    mainQueryCommand = "SELECT `" + DBTable_Add_App::COLUMN_LIST.join("`,`") + "` FROM " + DBTable_Add_App::NAME + " WHERE " +
+        DBTable_Add_App::COL_ID + " == ?";
 
     // Make query and return result regardless of outcome
     resultBuffer.source = DBTable_Add_App::NAME;
-    return makeNonBindQuery(resultBuffer, &fpDB, mainQueryCommand, sizeQueryCommand);
+    return makeCachedBindQuery(resultBuffer, &fpDB, mainQueryCommand, {appIDString}, true);
 }
 
 QSqlError Install::queryEntryAddApps(DBQueryBuffer& resultBuffer, QUuid appID, bool playableOnly) const
@@ -913,17 +1157,15 @@ QSqlError Install::queryEntryAddApps(DBQueryBuffer& resultBuffer, QUuid appID, b
     QSqlDatabase fpDB = getThreadedDatabaseConnection();
 
     // Make query
-    QString baseQueryCommand = "SELECT %1 FROM " + DBTable_Add_App::NAME + " WHERE " +
-            DBTable_Add_App::COL_PARENT_ID + " == '" + appID.toString(QUuid::WithoutBraces) + "'";
+    QString mainQueryCommand = "SELECT `" + DBTable_Add_App::COLUMN_LIST.join("`,`") + "` FROM " + DBTable_Add_App::NAME + " WHERE " +
+            DBTable_Add_App::COL_PARENT_ID + " == ?";
     if(playableOnly)
-        baseQueryCommand += " AND " + DBTable_Add_App::COL_APP_PATH + " NOT IN ('" + DBTable_Add_App::ENTRY_EXTRAS +
+        mainQueryCommand += " AND " + DBTable_Add_App::COL_APP_PATH + " NOT IN ('" + DBTable_Add_App::ENTRY_EXTRAS +
                             "','" + DBTable_Add_App::ENTRY_MESSAGE + "') AND " + DBTable_Add_App::COL_AUTORUN +
                             " != 1";
-    QString mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Add_App::COLUMN_LIST.join("`,`") + "`");
-    QString sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
 
     resultBuffer.source = DBTable_Add_App::NAME;
-    return makeNonBindQuery(resultBuffer, &fpDB, mainQueryCommand, sizeQueryCommand);
+    return makeCachedBindQuery(resultBuffer, &fpDB, mainQueryCommand, {appID.toString(QUuid::WithoutBraces)}, true);
 }
 
 QSqlError Install::queryAllGameIDs(DBQueryBuffer& resultBuffer, LibraryFilter filter) const
@@ -939,10 +1181,9 @@ QSqlError Install::queryAllGameIDs(DBQueryBuffer& resultBuffer, LibraryFilter fi
                                DBTable_Game::COL_STATUS + " != '" + DBTable_Game::ENTRY_NOT_WORK + "'%1";
     baseQueryCommand = baseQueryCommand.arg(filter == LibraryFilter::Game ? " AND " + GAME_ONLY_FILTER : (filter == LibraryFilter::Anim ? " AND " + ANIM_ONLY_FILTER : ""));
     QString mainQueryCommand = baseQueryCommand.arg("`" + DBTable_Game::COL_ID + "`");
-    QString sizeQueryCommand = baseQueryCommand.arg(GENERAL_QUERY_SIZE_COMMAND);
 
     resultBuffer.source = DBTable_Game::NAME;
-    return makeNonBindQuery(resultBuffer, &fpDB, mainQueryCommand, sizeQueryCommand);
+    return makeNonBindQuery(resultBuffer, &fpDB, mainQueryCommand, true);
 }
 
 QString Install::getPath() const { return mRootDirectory.absolutePath(); }
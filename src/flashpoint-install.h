@@ -6,6 +6,7 @@
 #include <QFile>
 #include <QtSql>
 #include "qx.h"
+#include "flashpoint.h"
 
 namespace FP
 {
@@ -16,6 +17,7 @@ class Install
 public:
     enum class CompatLevel{ Execution, Full };
     enum class LibraryFilter{ Game, Anim, Either };
+    enum class ConnectionProfile{ Standard, BulkRead };
 
 //-Class Structs-------------------------------------------------------------------------------------------------
 public:
@@ -35,7 +37,7 @@ public:
     {
         QString source;
         QSqlQuery result;
-        int size = 0;
+        int size = -1; // -1 when not measured, read result until next() returns false
     };
 
     struct Config
@@ -112,6 +114,11 @@ public:
                                                COL_BROKEN, COL_EXTREME, COL_PLAY_MODE, COL_STATUS, COL_NOTES, COL_SOURCE, COL_APP_PATH, COL_LAUNCH_COMMAND, COL_RELEASE_DATE,
                                                COL_VERSION, COL_ORIGINAL_DESC, COL_LANGUAGE, COL_LIBRARY, COL_ORDER_TITLE};
 
+        // Positions within COLUMN_LIST, keep in the same order (IDX_COUNT is checked against its size on construction of Install)
+        enum ColumnIndex {IDX_ID, IDX_TITLE, IDX_SERIES, IDX_DEVELOPER, IDX_PUBLISHER, IDX_DATE_ADDED, IDX_DATE_MODIFIED, IDX_PLATFORM,
+                          IDX_BROKEN, IDX_EXTREME, IDX_PLAY_MODE, IDX_STATUS, IDX_NOTES, IDX_SOURCE, IDX_APP_PATH, IDX_LAUNCH_COMMAND, IDX_RELEASE_DATE,
+                          IDX_VERSION, IDX_ORIGINAL_DESC, IDX_LANGUAGE, IDX_LIBRARY, IDX_ORDER_TITLE, IDX_COUNT};
+
         static inline const QString ENTRY_GAME_LIBRARY = "arcade";
         static inline const QString ENTRY_ANIM_LIBRARY = "theatre";
         static inline const QString ENTRY_NOT_WORK = "Not Working";
@@ -132,6 +139,9 @@ public:
 
         static inline const QStringList COLUMN_LIST = {COL_ID, COL_APP_PATH, COL_AUTORUN, COL_LAUNCH_COMMAND, COL_NAME, COL_WAIT_EXIT, COL_PARENT_ID};
 
+        // Positions within COLUMN_LIST, keep in the same order (IDX_COUNT is checked against its size on construction of Install)
+        enum ColumnIndex {IDX_ID, IDX_APP_PATH, IDX_AUTORUN, IDX_LAUNCH_COMMAND, IDX_NAME, IDX_WAIT_EXIT, IDX_PARENT_ID, IDX_COUNT};
+
         static inline const QString ENTRY_EXTRAS = ":extras:";
         static inline const QString ENTRY_MESSAGE = ":message:";
     };
@@ -149,6 +159,9 @@ public:
         static inline const QString ENTRY_GAME_LIBRARY = "arcade";
 
         static inline const QStringList COLUMN_LIST = {COL_ID, COL_TITLE, COL_DESCRIPTION, COL_AUTHOR, COL_LIBRARY};
+
+        // Positions within COLUMN_LIST, keep in the same order (IDX_COUNT is checked against its size on construction of Install)
+        enum ColumnIndex {IDX_ID, IDX_TITLE, IDX_DESCRIPTION, IDX_AUTHOR, IDX_LIBRARY, IDX_COUNT};
     };
 
     class DBTable_Playlist_Game
@@ -162,6 +175,9 @@ public:
         static inline const QString COL_GAME_ID = "gameId";
 
         static inline const QStringList COLUMN_LIST = {COL_ID, COL_PLAYLIST_ID, COL_ORDER, COL_GAME_ID};
+
+        // Positions within COLUMN_LIST, keep in the same order (IDX_COUNT is checked against its size on construction of Install)
+        enum ColumnIndex {IDX_ID, IDX_PLAYLIST_ID, IDX_ORDER, IDX_GAME_ID, IDX_COUNT};
     };
 
     class JSONObject_Config
@@ -307,6 +323,12 @@ public:
                                                                         {DBTable_Playlist::NAME, DBTable_Playlist::COLUMN_LIST},
                                                                         {DBTable_Playlist_Game::NAME, DBTable_Playlist_Game::COLUMN_LIST}};
     static inline const QString GENERAL_QUERY_SIZE_COMMAND = "COUNT(1)";
+    static inline const QString TEMP_GAME_ID_FILTER_TABLE = "temp.game_id_filter";
+
+    static inline const QString CONNECT_OPTIONS_STANDARD = "QSQLITE_OPEN_READONLY";
+    static inline const QStringList BULK_READ_PRAGMAS = {"PRAGMA mmap_size = 268435456", // 256 MiB
+                                                         "PRAGMA cache_size = -65536", // 64 MiB
+                                                         "PRAGMA temp_store = MEMORY"};
 
     static inline const QString GAME_ONLY_FILTER = DBTable_Game::COL_LIBRARY + " = '" + DBTable_Game::ENTRY_GAME_LIBRARY + "'";
     static inline const QString ANIM_ONLY_FILTER = DBTable_Game::COL_LIBRARY + " = '" + DBTable_Game::ENTRY_ANIM_LIBRARY + "'";
@@ -330,6 +352,11 @@ private:
     QStringList mPlatformList;
     QStringList mPlaylistList;
 
+    // Prepared statements by connection, then by query. A statement is only reused once its previous result has been released
+    // with QSqlQuery::finish(), while that result is still active a fresh statement is prepared in its place instead
+    mutable QHash<QString, QHash<QString, QSqlQuery>> mPreparedQueryCache;
+    mutable QMutex mPreparedQueryCacheMutex;
+
 //-Constructor-------------------------------------------------------------------------------------------------
 public:
     Install(QString installPath);
@@ -342,10 +369,19 @@ public:
 public:
     static ValidityReport checkInstallValidity(QString installPath, CompatLevel compatLevel);
 
+    // Record decoding, the query must select the table's full COLUMN_LIST
+    static Game gameFromRecord(const QSqlQuery& record);
+    static AddApp addAppFromRecord(const QSqlQuery& record);
+    static Playlist playlistFromRecord(const QSqlQuery& record);
+    static PlaylistGame playlistGameFromRecord(const QSqlQuery& record);
+
 //-Instance Functions------------------------------------------------------------------------------------------------------
 private:
     QSqlDatabase getThreadedDatabaseConnection() const;
-    QSqlError makeNonBindQuery(DBQueryBuffer& resultBuffer, QSqlDatabase* database, QString queryCommand, QString sizeQueryCommand) const;
+    QSqlError makeNonBindQuery(DBQueryBuffer& resultBuffer, QSqlDatabase* database, QString queryCommand, bool measureSize = false) const;
+    QSqlError makeCachedBindQuery(DBQueryBuffer& resultBuffer, QSqlDatabase* database, QString queryCommand, const QVariantList& bindValues,
+                                  bool measureSize = false) const;
+    QString makeGameFilterCommand(InclusionOptions inclusionOptions, bool useIDFilter) const;
 
 public:
     // General Information
@@ -354,7 +390,7 @@ public:
     Qx::MMRB currentCLIFpVersion() const;
 
     // Connection
-    QSqlError openThreadDatabaseConnection();
+    QSqlError openThreadDatabaseConnection(ConnectionProfile profile = ConnectionProfile::Standard);
     void closeThreadedDatabaseConnection();
     bool databaseConnectionOpenInThisThread();
 
@@ -371,12 +407,17 @@ public:
     bool deployCLIFp(QString &errorMessage);
 
     // Queries - OFLIb
-    QSqlError queryGamesByPlatform(QList<DBQueryBuffer>& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
-                                   const QList<QUuid>& idFilter = {}) const;
-    QSqlError queryAllAddApps(DBQueryBuffer& resultBuffer) const;
+    QSqlError queryGameCountsByPlatform(QHash<QString, int>& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
+                                        bool useIDFilter = false) const;
+    QSqlError queryGameIDsByPlatform(DBQueryBuffer& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
+                                     bool useIDFilter = false) const; // Selects ID, platform and dateModified
+    QSqlError queryGamesByPlatform(DBQueryBuffer& resultBuffer, QStringList platforms, InclusionOptions inclusionOptions,
+                                   bool useIDFilter = false, QString modifiedAfter = QString()) const; // 'modifiedAfter' as stored, null for all
+    QSqlError queryAddAppsByPlatform(DBQueryBuffer& resultBuffer, QString platform, InclusionOptions inclusionOptions,
+                                     bool useIDFilter = false, QString modifiedAfter = QString()) const; // Of the games that would be selected
     QSqlError queryPlaylistsByName(DBQueryBuffer& resultBuffer, QStringList playlists) const;
     QSqlError queryPlaylistGamesByPlaylist(QList<DBQueryBuffer>& resultBuffer, const QList<QUuid>& playlistIDs) const;
-    QSqlError queryPlaylistGameIDs(DBQueryBuffer& resultBuffer, const QList<QUuid>& playlistIDs) const;
+    QSqlError loadPlaylistGameIDFilter(const QList<QUuid>& playlistIDs) const; // Sets the IDs used when 'useIDFilter' is true
 
     // Queries - CLIFp
     QSqlError queryEntryByID(DBQueryBuffer& resultBuffer, QUuid appID) const;
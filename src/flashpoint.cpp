@@ -12,6 +12,24 @@ namespace FP
 //Public:
 Game::Game() {}
 
+//-Serialization----------------------------------------------------------------------------------------------------
+//Public:
+QDataStream& operator<< (QDataStream& stream, const Game& game)
+{
+    return stream << game.mID << game.mTitle << game.mSeries << game.mDeveloper << game.mPublisher << game.mDateAdded
+                  << game.mDateModified << game.mPlatform << game.mBroken << game.mPlayMode << game.mStatus << game.mNotes
+                  << game.mSource << game.mAppPath << game.mLaunchCommand << game.mReleaseDate << game.mVersion
+                  << game.mOriginalDescription << game.mLanguage << game.mOrderTitle << game.mLibrary;
+}
+
+QDataStream& operator>> (QDataStream& stream, Game& game)
+{
+    return stream >> game.mID >> game.mTitle >> game.mSeries >> game.mDeveloper >> game.mPublisher >> game.mDateAdded
+                  >> game.mDateModified >> game.mPlatform >> game.mBroken >> game.mPlayMode >> game.mStatus >> game.mNotes
+                  >> game.mSource >> game.mAppPath >> game.mLaunchCommand >> game.mReleaseDate >> game.mVersion
+                  >> game.mOriginalDescription >> game.mLanguage >> game.mOrderTitle >> game.mLibrary;
+}
+
 //-Instance Functions------------------------------------------------------------------------------------------------
 //Public:
 QUuid Game::getID() const { return mID; }
@@ -128,6 +146,20 @@ uint qHash(const AddApp& key, uint seed) noexcept
     return seed;
 }
 
+//-Serialization----------------------------------------------------------------------------------------------------
+//Public:
+QDataStream& operator<< (QDataStream& stream, const AddApp& addApp)
+{
+    return stream << addApp.mID << addApp.mAppPath << addApp.mAutorunBefore << addApp.mLaunchCommand << addApp.mName
+                  << addApp.mWaitExit << addApp.mParentID;
+}
+
+QDataStream& operator>> (QDataStream& stream, AddApp& addApp)
+{
+    return stream >> addApp.mID >> addApp.mAppPath >> addApp.mAutorunBefore >> addApp.mLaunchCommand >> addApp.mName
+                  >> addApp.mWaitExit >> addApp.mParentID;
+}
+
 //-Instance Functions------------------------------------------------------------------------------------------------
 //Public:
 QUuid AddApp::getID() const { return mID; }
@@ -4,6 +4,7 @@
 #include <QString>
 #include <QDateTime>
 #include <QUuid>
+#include <QDataStream>
 
 namespace FP
 {
@@ -47,6 +48,11 @@ private:
 public:
     Game();
 
+//-Serialization-------------------------------------------------------------------------------------------------------
+public:
+    friend QDataStream& operator<< (QDataStream& stream, const Game& game);
+    friend QDataStream& operator>> (QDataStream& stream, Game& game);
+
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
     QUuid getID() const;
@@ -139,6 +145,11 @@ public:
 public:
     friend uint qHash(const AddApp& key, uint seed) noexcept;
 
+//-Serialization-------------------------------------------------------------------------------------------------------
+public:
+    friend QDataStream& operator<< (QDataStream& stream, const AddApp& addApp);
+    friend QDataStream& operator>> (QDataStream& stream, AddApp& addApp);
+
 //-Instance Functions------------------------------------------------------------------------------------------------------
 public:
     QUuid getID() const;
@@ -1,4 +1,78 @@
 #include "import-worker.h"
+#include <QtConcurrent>
+#include <QCryptographicHash>
+#include <QStandardPaths>
+#include <QSaveFile>
+#include <vector>
+
+//===============================================================================================================
+// IMPORT WORKER::PlatformFeed
+//===============================================================================================================
+
+//-Constructor---------------------------------------------------------------------------------------------------
+//Public:
+ImportWorker::PlatformFeed::PlatformFeed() : mClosed(false), mComplete(false), mAbandoned(false) {}
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Public:
+void ImportWorker::PlatformFeed::put(Batch batch)
+{
+    QMutexLocker feedLocker(&mMutex);
+
+    // Wait for the job to catch up, unless it has stopped
+    while(!mAbandoned && mBatches.size() >= PLATFORM_FEED_DEPTH)
+        mBatchTaken.wait(&mMutex);
+
+    if(!mAbandoned)
+    {
+        mBatches.enqueue(std::move(batch));
+        mBatchAdded.wakeOne();
+    }
+}
+
+void ImportWorker::PlatformFeed::close(bool complete)
+{
+    QMutexLocker feedLocker(&mMutex);
+
+    // Only the first close counts
+    if(mClosed)
+        return;
+
+    mClosed = true;
+    mComplete = complete;
+    mBatchAdded.wakeOne();
+}
+
+bool ImportWorker::PlatformFeed::take(Batch& batchBuffer)
+{
+    QMutexLocker feedLocker(&mMutex);
+
+    while(mBatches.isEmpty() && !mClosed)
+        mBatchAdded.wait(&mMutex);
+
+    // Remaining batches of an incomplete platform are of no use
+    if(mBatches.isEmpty() || (mClosed && !mComplete))
+        return false;
+
+    batchBuffer = mBatches.dequeue();
+    mBatchTaken.wakeOne();
+    return true;
+}
+
+void ImportWorker::PlatformFeed::abandon()
+{
+    QMutexLocker feedLocker(&mMutex);
+
+    mAbandoned = true;
+    mBatches.clear();
+    mBatchTaken.wakeOne();
+}
+
+bool ImportWorker::PlatformFeed::isComplete() const
+{
+    QMutexLocker feedLocker(&mMutex);
+    return mComplete;
+}
 
 //===============================================================================================================
 // IMPORT WORKER
@@ -12,7 +86,28 @@ ImportWorker::ImportWorker(std::shared_ptr<FP::Install> fpInstallForWork,
     : mFlashpointInstall(fpInstallForWork),
       mLaunchBoxInstall(lbInstallForWork),
       mImportSelections(importSelections),
-      mOptionSet(optionSet) {}
+      mOptionSet(optionSet)
+{
+    // Bound the number of platforms processed at once
+    mPlatformPool.setMaxThreadCount(QThread::idealThreadCount());
+
+    // Image transfers spend most of their time waiting on the disk, so use more threads than cores
+    mImageTransferPool.setMaxThreadCount(IMAGE_TRANSFER_THREAD_COUNT);
+}
+
+//-Class Functions-----------------------------------------------------------------------------------------------
+//Private:
+template<typename Entry>
+QByteArray ImportWorker::entryDigest(const Entry& entry)
+{
+    // Hash serialized form, covers every imported field
+    QByteArray serialized;
+    QDataStream digestStream(&serialized, QIODevice::WriteOnly);
+    digestStream.setVersion(QDataStream::Qt_5_15);
+    digestStream << entry;
+
+    return QCryptographicHash::hash(serialized, QCryptographicHash::Md5);
+}
 
 //-Instance Functions--------------------------------------------------------------------------------------------
 //Private
@@ -20,20 +115,10 @@ const QList<QUuid> ImportWorker::preloadPlaylists(FP::Install::DBQueryBuffer& pl
 {
     QList<QUuid> targetPlaylistIDs;
 
-    for(int i = 0; i < playlistQuery.size; i++)
+    while(playlistQuery.result.next())
     {
-        // Advance to next record
-        playlistQuery.result.next();
-
         // Form playlist from record
-        FP::PlaylistBuilder fpPb;
-        fpPb.wID(playlistQuery.result.value(FP::Install::DBTable_Playlist::COL_ID).toString());
-        fpPb.wTitle(playlistQuery.result.value(FP::Install::DBTable_Playlist::COL_TITLE).toString());
-        fpPb.wDescription(playlistQuery.result.value(FP::Install::DBTable_Playlist::COL_DESCRIPTION).toString());
-        fpPb.wAuthor(playlistQuery.result.value(FP::Install::DBTable_Playlist::COL_AUTHOR).toString());
-
-        // Build playlist
-        FP::Playlist playlist = fpPb.build();
+        FP::Playlist playlist = FP::Install::playlistFromRecord(playlistQuery.result);
 
         // Add to cache
         mPlaylistsCache[playlist.getID()] = playlist;
@@ -45,231 +130,582 @@ const QList<QUuid> ImportWorker::preloadPlaylists(FP::Install::DBQueryBuffer& pl
     return targetPlaylistIDs;
 }
 
-const QList<QUuid> ImportWorker::getPlaylistSpecificGameIDs(FP::Install::DBQueryBuffer& playlistGameIDQuery)
+int ImportWorker::postBlockingError(Qx::GenericError blockingError, QMessageBox::StandardButtons choices, int defaultChoice)
+{
+    // Only one platform job may wait on the user at a time
+    QMutexLocker errorLocker(&mBlockingErrorMutex);
+
+    // Set default choice incase the signal is not correctly connected using Qt::BlockingQueuedConnection
+    *mBlockingErrorResponse = defaultChoice;
+
+    // Notify GUI Thread of error and return response
+    emit blockingErrorOccured(mBlockingErrorResponse, blockingError, choices);
+    return *mBlockingErrorResponse;
+}
+
+QByteArray ImportWorker::optionsDigest(bool playlistSpecific) const
 {
-    QList<QUuid> playlistSpecGameIDs;
+    // Everything other than the games themselves that affects a platform doc's contents
+    QByteArray serialized;
+    QDataStream digestStream(&serialized, QIODevice::WriteOnly);
+    digestStream.setVersion(QDataStream::Qt_5_15);
+    digestStream << int(mOptionSet.updateOptions.importMode) << mOptionSet.updateOptions.removeObsolete << int(mOptionSet.imageMode)
+                 << mOptionSet.inclusionOptions.includeExtreme << mOptionSet.inclusionOptions.includeAnimations << playlistSpecific
+                 << mFlashpointInstall->getPath() << mFlashpointInstall->getCLIFpPath();
+
+    return QCryptographicHash::hash(serialized, QCryptographicHash::Md5);
+}
 
-    for(int i = 0; i < playlistGameIDQuery.size; i++)
+QString ImportWorker::platformStatePath(QString platform) const
+{
+    // Keep the states of different LaunchBox installs apart
+    QString installKey = QCryptographicHash::hash(mLaunchBoxInstall->getPath().toUtf8(), QCryptographicHash::Md5).toHex();
+    QString platformKey = QCryptographicHash::hash(platform.toUtf8(), QCryptographicHash::Md5).toHex();
+
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + '/' + IMPORT_STATE_FOLDER_NAME + '/' +
+           installKey + '/' + platformKey + IMPORT_STATE_EXT;
+}
+
+bool ImportWorker::loadPlatformState(PlatformImportState& stateBuffer, QString platform) const
+{
+    QFile stateFile(platformStatePath(platform));
+    if(!stateFile.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream stateStream(&stateFile);
+    stateStream.setVersion(QDataStream::Qt_5_15);
+
+    // Check format version
+    quint32 stateVersion = 0;
+    stateStream >> stateVersion;
+    if(stateVersion != IMPORT_STATE_VERSION)
+        return false;
+
+    // Read state
+    stateStream >> stateBuffer;
+    return stateStream.status() == QDataStream::Ok;
+}
+
+void ImportWorker::savePlatformState(const PlatformImportState& state, QString platform) const
+{
+    // Failures are ignored, the next import of the platform is just done in full
+    QString statePath = platformStatePath(platform);
+    if(!QDir().mkpath(QFileInfo(statePath).absolutePath()))
+        return;
+
+    QSaveFile stateFile(statePath);
+    if(!stateFile.open(QIODevice::WriteOnly))
+        return;
+
+    QDataStream stateStream(&stateFile);
+    stateStream.setVersion(QDataStream::Qt_5_15);
+    stateStream << IMPORT_STATE_VERSION << state;
+
+    if(stateStream.status() == QDataStream::Ok)
+        stateFile.commit();
+    else
+        stateFile.cancelWriting();
+}
+
+void ImportWorker::advanceProgress(int steps)
+{
+    // Only pass on whole percent changes, one queued update per entry floods the GUI thread
+    int value = mCurrentProgressValue += steps;
+    int maximum = mMaximumProgressValue;
+    if(maximum <= 0 || value >= maximum || value * 100LL / maximum != (value - steps) * 100LL / maximum)
+        emit progressValueChanged(value);
+}
+
+void ImportWorker::transferGameImages(const LB::Game& game)
+{
+    // Setup for transfering images
+    QString imageTransferError; // Error return reference
+    bool skipAllImages = false; // NoToAll response tracker
+    int response;
+
+    while(!skipAllImages && !mLaunchBoxInstall->transferLogo(imageTransferError, mOptionSet.imageMode, mFlashpointInstall->getLogosDirectory(), game))
     {
-        // Advance to next record
-        playlistGameIDQuery.result.next();
+        // Notify GUI Thread of error
+        response = postBlockingError(Qx::GenericError(Qx::GenericError::Error, imageTransferError, "Retry?", QString(), CAPTION_IMAGE_ERR),
+                                     QMessageBox::Yes | QMessageBox::No | QMessageBox::NoToAll, QMessageBox::NoToAll);
+
+        // Check response
+        if(response == QMessageBox::No)
+           break;
+        else if(response == QMessageBox::NoToAll)
+           skipAllImages = true;
+    }
 
-        // Add ID to list
-        playlistSpecGameIDs.append(QUuid(playlistGameIDQuery.result.value(FP::Install::DBTable_Playlist_Game::COL_GAME_ID).toString()));
+    while(!skipAllImages && !mLaunchBoxInstall->transferScreenshot(imageTransferError, mOptionSet.imageMode, mFlashpointInstall->getScrenshootsDirectory(), game))
+    {
+        // Notify GUI Thread of error
+        response = postBlockingError(Qx::GenericError(Qx::GenericError::Error, imageTransferError, "Retry?", QString(), CAPTION_IMAGE_ERR),
+                                     QMessageBox::Yes | QMessageBox::No | QMessageBox::NoToAll, QMessageBox::NoToAll);
+
+        // Check response
+        if(response == QMessageBox::No)
+           break;
+        else if(response == QMessageBox::NoToAll)
+           skipAllImages = true;
     }
+}
+
+void ImportWorker::queueImageTransfer(const LB::Game& game)
+{
+    // Wait for room in the queue so a slow disk holds back game building instead of piling up games
+    mImageTransferSlots.acquire();
+
+    mImageTransferPool.start([this, game](){
+        // Images queued before a cancel or failure are dropped, the import is being reverted anyway
+        if(!mCanceled && !mPlatformJobFailed)
+            transferGameImages(game);
+
+        mImageTransferSlots.release();
+    });
+}
+
+void ImportWorker::finishImageTransfers()
+{
+    // Images must all be in place (or tracked for revert) before the import moves on
+    if(mImageTransferSlots.available() < IMAGE_TRANSFER_QUEUE_LIMIT)
+        emit progressStepChanged(STEP_FINISHING_IMAGE_TRANSFERS);
 
-    return playlistSpecGameIDs;
+    mImageTransferPool.waitForDone();
 }
 
-ImportWorker::ImportResult ImportWorker::preloadAddApps(Qx::GenericError& errorReport, FP::Install::DBQueryBuffer& addAppQuery)
+void ImportWorker::checkKeptGameImages(QUuid gameID, QString platform)
 {
-    mAddAppsCache.reserve(addAppQuery.size);
-    for(int i = 0; i < addAppQuery.size; i++)
+    // Kept games only need a transfer if the pre-scans show their images are missing or out of date
+    if(!mLaunchBoxInstall->gameImagesCurrent(mOptionSet.imageMode, mFlashpointInstall->getLogosDirectory(),
+                                             mFlashpointInstall->getScrenshootsDirectory(), gameID, platform))
     {
-        // Advance to next record
-        addAppQuery.result.next();
-
-        // Form additional app from record
-        FP::AddAppBuilder fpAab;
-        fpAab.wID(addAppQuery.result.value(FP::Install::DBTable_Add_App::COL_ID).toString());
-        fpAab.wAppPath(addAppQuery.result.value(FP::Install::DBTable_Add_App::COL_APP_PATH).toString());
-        fpAab.wAutorunBefore(addAppQuery.result.value(FP::Install::DBTable_Add_App::COL_AUTORUN).toString());
-        fpAab.wLaunchCommand(addAppQuery.result.value(FP::Install::DBTable_Add_App::COL_LAUNCH_COMMAND).toString());
-        fpAab.wName(addAppQuery.result.value(FP::Install::DBTable_Add_App::COL_NAME).toString());
-        fpAab.wWaitExit(addAppQuery.result.value(FP::Install::DBTable_Add_App::COL_WAIT_EXIT).toString());
-        fpAab.wParentID(addAppQuery.result.value(FP::Install::DBTable_Add_App::COL_PARENT_ID).toString());
-
-        // Build additional app
-        FP::AddApp additionalApp = fpAab.build();
+        LB::GameBuilder gb;
+        gb.wID(gameID.toString(QUuid::WithoutBraces));
+        gb.wPlatform(platform);
+        queueImageTransfer(gb.build());
+    }
+}
 
-        // Add to cache
-        mAddAppsCache.insert(additionalApp);
+ImportWorker::PlatformPlan ImportWorker::planPlatform(QString platform, const QList<QPair<QUuid, QString>>& gameStamps, bool playlistSpecific) const
+{
+    PlatformPlan plan{platform, playlistSpecific, optionsDigest(playlistSpecific), QString(), false, false, PlatformImportState(), QString(), {}, {}};
 
-        // Update progress dialog value
-        if(mCanceled)
+    // Newest modification among the platform's games (compared as stored, like the database does)
+    for(const QPair<QUuid, QString>& gameStamp : gameStamps)
+        if(gameStamp.second > plan.dateModifiedMark)
+            plan.dateModifiedMark = gameStamp.second;
+
+    // Compare against the previous import, only usable if it had the same options and the doc hasn't been touched since
+    QFileInfo docInfo(mLaunchBoxInstall->getPlatformDocPath(platform));
+    plan.incremental = loadPlatformState(plan.previousState, platform) && plan.previousState.optionsDigest == plan.optionsDigest &&
+                       !plan.previousState.dateModifiedMark.isEmpty() && docInfo.exists() && plan.previousState.docSize == docInfo.size() &&
+                       plan.previousState.docModified == docInfo.lastModified().toMSecsSinceEpoch();
+
+    // Otherwise all games are read
+    if(!plan.incremental)
+    {
+        plan.previousState = PlatformImportState();
+        return plan;
+    }
+
+    // Keep games that haven't been modified since, Flashpoint updates a game's dateModified when its additional apps change
+    plan.modifiedAfter = plan.previousState.dateModifiedMark;
+    for(const QPair<QUuid, QString>& gameStamp : gameStamps)
+    {
+        if(gameStamp.second > plan.modifiedAfter)
+            continue; // Read with the modified games
+        else if(plan.previousState.games.contains(gameStamp.first))
+            plan.keptGameIDs.append(gameStamp.first);
+        else
+            plan.addedGameIDs.append(gameStamp.first);
+    }
+
+    // Every game kept and none removed (kept games are a subset of the previous ones)
+    plan.upToDate = plan.keptGameIDs.size() == gameStamps.size() && plan.previousState.games.size() == gameStamps.size();
+
+    return plan;
+}
+
+QSqlError ImportWorker::feedPlatform(PlatformFeed& platformFeed, const PlatformPlan& plan)
+{
+    // Games modified since the previous import (playlist specific games use the loaded ID filter)
+    FP::Install::DBQueryBuffer gameResult;
+    QSqlError queryError = mFlashpointInstall->queryGamesByPlatform(gameResult, {plan.platform}, mOptionSet.inclusionOptions, plan.playlistSpecific,
+                                                                    plan.modifiedAfter);
+    if(queryError.isValid())
+        return queryError;
+
+    QList<FP::Game> gameBatch;
+    while(!mCanceled && !mPlatformJobFailed && gameResult.result.next())
+    {
+        gameBatch.append(FP::Install::gameFromRecord(gameResult.result)); // Form game from record
+        if(gameBatch.size() >= GAME_BATCH_SIZE)
         {
-           errorReport = Qx::GenericError();
-           return Canceled;
+            platformFeed.put({gameBatch, {}});
+            gameBatch.clear();
         }
-        else
-            emit progressValueChanged(++mCurrentProgressValue);
     }
 
-    // Report successful step completion
-    errorReport = Qx::GenericError();
-    return Successful;
+    if(gameResult.result.lastError().isValid())
+        return gameResult.result.lastError();
+
+    // Games new to the platform that weren't modified since, e.g. ones that just came under a selected playlist
+    for(const QUuid& gameID : plan.addedGameIDs)
+    {
+        FP::Install::DBQueryBuffer entryResult;
+        if((queryError = mFlashpointInstall->queryEntryByID(entryResult, gameID)).isValid())
+            return queryError;
+
+        if(entryResult.source == FP::Install::DBTable_Game::NAME && entryResult.result.next())
+            gameBatch.append(FP::Install::gameFromRecord(entryResult.result));
+
+        entryResult.result.finish(); // Lets the next lookup reuse the prepared statement
+    }
+
+    if(!gameBatch.isEmpty())
+        platformFeed.put({gameBatch, {}});
+
+    // Additional apps of the games that were read
+    QList<FP::AddApp> addAppBatch;
+    auto putAddAppBatch = [&](){
+        // Update progress dialog maximum now that these additional apps are known
+        mMaximumProgressValue += addAppBatch.size();
+        emit progressMaximumChanged(mMaximumProgressValue);
+
+        platformFeed.put({{}, addAppBatch});
+        addAppBatch.clear();
+    };
+
+    FP::Install::DBQueryBuffer addAppResult;
+    if((queryError = mFlashpointInstall->queryAddAppsByPlatform(addAppResult, plan.platform, mOptionSet.inclusionOptions, plan.playlistSpecific,
+                                                               plan.modifiedAfter)).isValid())
+        return queryError;
+
+    while(!mCanceled && !mPlatformJobFailed && addAppResult.result.next())
+    {
+        addAppBatch.append(FP::Install::addAppFromRecord(addAppResult.result)); // Form additional app from record
+        if(addAppBatch.size() >= GAME_BATCH_SIZE)
+            putAddAppBatch();
+    }
+
+    if(addAppResult.result.lastError().isValid())
+        return addAppResult.result.lastError();
+    addAppResult.result.finish(); // Lets the next platform reuse the prepared statement
+
+    for(const QUuid& gameID : plan.addedGameIDs)
+    {
+        if((queryError = mFlashpointInstall->queryEntryAddApps(addAppResult, gameID)).isValid())
+            return queryError;
+
+        while(addAppResult.result.next())
+            addAppBatch.append(FP::Install::addAppFromRecord(addAppResult.result));
+        addAppResult.result.finish();
+    }
+
+    if(!addAppBatch.isEmpty())
+        putAddAppBatch();
+
+    return QSqlError();
 }
 
-ImportWorker::ImportResult ImportWorker::processGames(Qx::GenericError& errorReport, QList<FP::Install::DBQueryBuffer>& gameQueries, bool playlistSpecific)
+ImportWorker::PlatformJobResult ImportWorker::processPlatform(const PlatformPlan& plan, std::shared_ptr<PlatformFeed> platformFeed)
 {
-    for(int i = 0; i < gameQueries.size(); i++)
+    // Update progress dialog label
+    emit progressStepChanged((plan.playlistSpecific ? STEP_IMPORTING_PLAYLIST_SPEC_GAMES : STEP_IMPORTING_PLATFORM_GAMES).arg(plan.platform));
+
+    // Setup for ensuring image sub-directories exist
+    QString imageDirError; // Error return reference
+
+    // Check image sub-directories
+    while(!mLaunchBoxInstall->ensureImageDirectories(imageDirError, plan.platform))
     {
-        // Get current result
-        FP::Install::DBQueryBuffer& currentPlatformGameResult = gameQueries[i];
+        // Notify GUI Thread of error and check response
+        if(postBlockingError(Qx::GenericError(Qx::GenericError::Error, imageDirError, "Retry?", QString(), CAPTION_IMAGE_ERR),
+                             QMessageBox::Yes | QMessageBox::No, QMessageBox::No) == QMessageBox::No)
+           break;
+    }
 
-        // Update progress dialog label
-        emit progressStepChanged((playlistSpecific ? STEP_IMPORTING_PLAYLIST_SPEC_GAMES : STEP_IMPORTING_PLATFORM_GAMES).arg(currentPlatformGameResult.source));
+    // List the platform's existing images in one pass
+    if(mOptionSet.imageMode != LB::Install::Reference)
+        mLaunchBoxInstall->scanPlatformImages(plan.platform);
 
-        // Open LB platform doc
-        LB::Xml::DataDocHandle docRequest = {LB::Xml::PlatformDoc::TYPE_NAME, currentPlatformGameResult.source};
-        std::unique_ptr<LB::Xml::PlatformDoc> currentPlatformXML;
-        Qx::XmlStreamReaderError platformReadError = mLaunchBoxInstall->openPlatformDoc(currentPlatformXML, docRequest.docName, mOptionSet.updateOptions);
+    // Leave the doc alone if nothing changed since the previous import, only checking that the images are still in place
+    if(plan.upToDate)
+    {
+        mPlaylistGameDetailsMutex.lock();
+        mPlaylistGameDetailsCache.insert(plan.previousState.docGameDetails);
+        mPlaylistGameDetailsMutex.unlock();
 
-        // Stop import if error occured
-        if(platformReadError.isValid())
+        if(mOptionSet.imageMode != LB::Install::Reference)
         {
-            // Emit import failure
-            errorReport = Qx::GenericError(Qx::GenericError::Critical, LB::Xml::formatDataDocError(MSG_LB_XML_UNEXPECTED_ERROR, docRequest),
-                                           platformReadError.getText());
-            return Failed;
+            for(auto itr = plan.previousState.games.constBegin(); itr != plan.previousState.games.constEnd(); itr++)
+            {
+                if(mCanceled || mPlatformJobFailed)
+                    return {Canceled, Qx::GenericError()};
+
+                checkKeptGameImages(itr.key(), plan.platform);
+            }
         }
 
-        // Setup for ensuring image sub-directories exist
-        QString imageDirError; // Error return reference
-        *mBlockingErrorResponse = QMessageBox::No; // Default to choice "No" incase the signal is not correctly connected using Qt::BlockingQueuedConnection
+        advanceProgress(plan.previousState.games.size());
+        return {Successful, Qx::GenericError()};
+    }
+
+    // This import's state of the platform, built as entries are added
+    PlatformImportState currentState{plan.optionsDigest, 0, 0, plan.dateModifiedMark, {}, {}, {}};
+    const PlatformImportState& previousState = plan.previousState;
+
+    // Open LB platform doc
+    LB::Xml::DataDocHandle docRequest = {LB::Xml::PlatformDoc::TYPE_NAME, plan.platform};
+    std::unique_ptr<LB::Xml::PlatformDoc> currentPlatformXML;
+    Qx::XmlStreamReaderError platformReadError = mLaunchBoxInstall->openPlatformDoc(currentPlatformXML, docRequest.docName, mOptionSet.updateOptions);
+
+    // Stop import if error occured
+    if(platformReadError.isValid())
+    {
+        // Emit import failure
+        return {Failed, Qx::GenericError(Qx::GenericError::Critical, LB::Xml::formatDataDocError(MSG_LB_XML_UNEXPECTED_ERROR, docRequest),
+                                         platformReadError.getText())};
+    }
+
+    // Report a doc error, dropping the previous state if the doc doesn't match it so the next import is done in full
+    auto failOnDoc = [&](){
+        if(plan.incremental)
+            QFile::remove(platformStatePath(plan.platform));
+
+        return PlatformJobResult{Failed, Qx::GenericError(Qx::GenericError::Critical, LB::Xml::formatDataDocError(MSG_LB_XML_UNEXPECTED_ERROR, docRequest),
+                                                          platformReadError.getText())};
+    };
+
+    // Copy games that weren't modified since the previous import straight from the existing doc
+    for(const QUuid& gameID : plan.keptGameIDs)
+    {
+        if((platformReadError = currentPlatformXML->keepExistingGame(gameID, previousState.docGameDetails.value(gameID))).isValid())
+            return failOnDoc();
+
+        currentState.games.insert(gameID, previousState.games.value(gameID));
+
+        if(mOptionSet.imageMode != LB::Install::Reference)
+            checkKeptGameImages(gameID, plan.platform);
 
-        // Check image sub-directories
-        while(!mLaunchBoxInstall->ensureImageDirectories(imageDirError, currentPlatformGameResult.source))
+        // Update progress dialog value
+        if(mCanceled || mPlatformJobFailed)
+            return {Canceled, Qx::GenericError()};
+        else
+            advanceProgress();
+    }
+
+    // Their additional apps follow all games
+    bool keptAddAppsWritten = false;
+    auto writeKeptAddApps = [&](){
+        keptAddAppsWritten = true;
+        for(const QUuid& gameID : plan.keptGameIDs)
         {
-            // Notify GUI Thread of error
-            emit blockingErrorOccured(mBlockingErrorResponse, Qx::GenericError(Qx::GenericError::Error, imageDirError, "Retry?", QString(), CAPTION_IMAGE_ERR),
-                                      QMessageBox::Yes | QMessageBox::No);
+            for(const QUuid& addAppID : previousState.games.value(gameID).addAppIDs)
+            {
+                if((platformReadError = currentPlatformXML->keepExistingAddApp(addAppID)).isValid())
+                    return false;
 
-            // Check response
-            if(*mBlockingErrorResponse == QMessageBox::No)
-               break;
+                currentState.addAppDigests.insert(addAppID, previousState.addAppDigests.value(addAppID));
+            }
         }
 
-        // Add/Update games
-        for(int j = 0; j < currentPlatformGameResult.size; j++)
+        return true;
+    };
+
+    // Add/Update the games that were read again, then their additional apps, as the reader hands them over
+    PlatformFeed::Batch batch;
+    bool addAppsStarted = false;
+
+    while(platformFeed->take(batch))
+    {
+        for(const FP::Game& platformGame : qAsConst(batch.games))
         {
-            // Advance to next record
-            currentPlatformGameResult.result.next();
-
-            // Form game from record
-            FP::GameBuilder fpGb;
-            fpGb.wID(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_ID).toString());
-            fpGb.wTitle(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_TITLE).toString());
-            fpGb.wSeries(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_SERIES).toString());
-            fpGb.wDeveloper(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_DEVELOPER).toString());
-            fpGb.wPublisher(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_PUBLISHER).toString());
-            fpGb.wDateAdded(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_DATE_ADDED).toString());
-            fpGb.wDateModified(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_DATE_MODIFIED).toString());
-            fpGb.wPlatform(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_PLATFORM).toString());
-            fpGb.wBroken(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_BROKEN).toString());
-            fpGb.wPlayMode(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_PLAY_MODE).toString());
-            fpGb.wStatus(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_STATUS).toString());
-            fpGb.wNotes(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_NOTES).toString());
-            fpGb.wSource(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_SOURCE).toString());
-            fpGb.wAppPath(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_APP_PATH).toString());
-            fpGb.wLaunchCommand(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_LAUNCH_COMMAND).toString());
-            fpGb.wReleaseDate(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_RELEASE_DATE).toString());
-            fpGb.wVersion(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_VERSION).toString());
-            fpGb.wOriginalDescription(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_ORIGINAL_DESC).toString());
-            fpGb.wLanguage(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_LANGUAGE).toString());
-            fpGb.wOrderTitle(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_ORDER_TITLE).toString());
-            fpGb.wLibrary(currentPlatformGameResult.result.value(FP::Install::DBTable_Game::COL_LIBRARY).toString());
-
-            // Convert and convert FP game to LB game and add to document
-            LB::Game builtGame = LB::Game(fpGb.build(), mFlashpointInstall->getCLIFpPath());
-            currentPlatformXML->addGame(builtGame);
-
-            // Setup for ensuring image sub-directories exist
-            QString imageTransferError; // Error return reference
-            *mBlockingErrorResponse = QMessageBox::NoToAll; // Default to choice "NoToAll" incase the signal is not correctly connected using Qt::BlockingQueuedConnection
-            bool skipAllImages = false; // NoToAll response tracker
-
-            // Transfer game images if applicable
+            // Record state, games whose content didn't change are copied from the existing doc as is
+            QUuid gameID = platformGame.getID();
+            QByteArray digest = entryDigest(platformGame);
+            bool unchanged = plan.incremental && previousState.games.value(gameID).digest == digest;
+            currentState.games.insert(gameID, ImportedGame{digest, {}});
+
+            // Convert FP game to LB game and add to document
+            LB::Game builtGame = LB::Game(platformGame, mFlashpointInstall->getCLIFpPath());
+            if((platformReadError = currentPlatformXML->addGame(builtGame, unchanged)).isValid())
+                return failOnDoc();
+
+            // Hand game images off to the transfer threads if applicable
             if(mOptionSet.imageMode != LB::Install::Reference)
-            {
-                while(!skipAllImages && !mLaunchBoxInstall->transferLogo(imageTransferError, mOptionSet.imageMode, mFlashpointInstall->getLogosDirectory(), builtGame))
-                {
-                    // Notify GUI Thread of error
-                    emit blockingErrorOccured(mBlockingErrorResponse, Qx::GenericError(Qx::GenericError::Error, imageTransferError, "Retry?", QString(), CAPTION_IMAGE_ERR),
-                                              QMessageBox::Yes | QMessageBox::No | QMessageBox::NoToAll);
-
-                    // Check response
-                    if(*mBlockingErrorResponse == QMessageBox::No)
-                       break;
-                    else if(*mBlockingErrorResponse == QMessageBox::NoToAll)
-                       skipAllImages = true;
-                }
-
-                while(!skipAllImages && !mLaunchBoxInstall->transferScreenshot(imageTransferError, mOptionSet.imageMode, mFlashpointInstall->getScrenshootsDirectory(), builtGame))
-                {
-                    // Notify GUI Thread of error
-                    emit blockingErrorOccured(mBlockingErrorResponse, Qx::GenericError(Qx::GenericError::Error, imageTransferError, "Retry?", QString(), CAPTION_IMAGE_ERR),
-                                              QMessageBox::Yes | QMessageBox::No | QMessageBox::NoToAll);
-
-                    // Check response
-                    if(*mBlockingErrorResponse == QMessageBox::No)
-                       break;
-                    else if(*mBlockingErrorResponse == QMessageBox::NoToAll)
-                       skipAllImages = true;
-                }
-            }
+                queueImageTransfer(builtGame);
 
             // Update progress dialog value
-            if(mCanceled)
-            {
-                errorReport = Qx::GenericError();
-                return Canceled;
-            }
+            if(mCanceled || mPlatformJobFailed)
+                return {Canceled, Qx::GenericError()};
             else
-                emit progressValueChanged(++mCurrentProgressValue);
+                advanceProgress();
         }
 
-        // Update progress dialog label
-        emit progressStepChanged((playlistSpecific ? STEP_IMPORTING_PLAYLIST_SPEC_ADD_APPS : STEP_IMPORTING_PLATFORM_ADD_APPS).arg(currentPlatformGameResult.source));
+        // Update progress dialog label once additional apps start
+        if(!batch.addApps.isEmpty() && !addAppsStarted)
+        {
+            emit progressStepChanged((plan.playlistSpecific ? STEP_IMPORTING_PLAYLIST_SPEC_ADD_APPS : STEP_IMPORTING_PLATFORM_ADD_APPS).arg(plan.platform));
+            addAppsStarted = true;
+
+            if(!writeKeptAddApps())
+                return failOnDoc();
+        }
 
-        // Add applicable additional apps
-        for (QSet<FP::AddApp>::iterator j = mAddAppsCache.begin(); j != mAddAppsCache.end();)
+        for(const FP::AddApp& platformAddApp : qAsConst(batch.addApps))
         {
-            // If the current platform doc contains the game this add app belongs to, convert and add it, then remove it from cache
-            if (currentPlatformXML->containsGame((*j).getParentID()))
-            {
-               currentPlatformXML->addAddApp(LB::AddApp(*j, mFlashpointInstall->getCLIFpPath()));
-               j = mAddAppsCache.erase(j);
+            // Record state
+            QUuid addAppID = platformAddApp.getID();
+            QByteArray digest = entryDigest(platformAddApp);
+            bool unchanged = plan.incremental && previousState.addAppDigests.value(addAppID) == digest;
+            currentState.addAppDigests.insert(addAppID, digest);
+            currentState.games[platformAddApp.getParentID()].addAppIDs.append(addAppID);
 
-               // Reduce progress dialog maximum by total iterations cut from future platforms
-               mMaximumProgressValue = mMaximumProgressValue - gameQueries.size() + i + 1; // Max = Max - (size - (i + 1))
-               emit progressMaximumChanged(mMaximumProgressValue);
-            }
-            else
-               ++j;
+            // Convert and add add app, unchanged ones are copied from the existing doc as is
+            if((platformReadError = currentPlatformXML->addAddApp(LB::AddApp(platformAddApp, mFlashpointInstall->getCLIFpPath()), unchanged)).isValid())
+                return failOnDoc();
 
             // Update progress dialog value
-            if(mCanceled)
-            {
-                errorReport = Qx::GenericError();
-                return Canceled;
-            }
+            if(mCanceled || mPlatformJobFailed)
+                return {Canceled, Qx::GenericError()};
             else
-                emit progressValueChanged(++mCurrentProgressValue);
+                advanceProgress();
         }
+    }
 
-        // Finalize document
-        currentPlatformXML->finalize();
+    // Leave the doc as is if the reader stopped partway through the platform
+    if(!platformFeed->isComplete())
+        return {Canceled, Qx::GenericError()};
 
-        // Add final game details to Playlist Game lookup cache
-        for (QHash<QUuid, LB::Game>::const_iterator i = currentPlatformXML->getFinalGames().constBegin();
-             i != currentPlatformXML->getFinalGames().constEnd(); ++i)
-           mPlaylistGameDetailsCache[i.key()] = {i.value().getTitle(), QFileInfo(i.value().getAppPath()).fileName(), i.value().getPlatform()};
+    // Write kept additional apps if none were read
+    if(!keptAddAppsWritten && !writeKeptAddApps())
+        return failOnDoc();
 
-        // Forefit doucment lease and save it
-        QString saveError;
-        if(!mLaunchBoxInstall->savePlatformDoc(saveError, std::move(currentPlatformXML)))
+    // Finalize document
+    if((platformReadError = currentPlatformXML->finalize()).isValid())
+        return failOnDoc();
+
+    // Add final game details to Playlist Game lookup cache
+    currentState.docGameDetails = currentPlatformXML->getFinalGameDetails();
+    mPlaylistGameDetailsMutex.lock();
+    mPlaylistGameDetailsCache.insert(currentState.docGameDetails);
+    mPlaylistGameDetailsMutex.unlock();
+
+    // Forefit doucment lease and save it
+    QString saveError;
+    if(!mLaunchBoxInstall->savePlatformDoc(saveError, std::move(currentPlatformXML)))
+        return {Failed, Qx::GenericError(Qx::GenericError::Critical, LB::Xml::formatDataDocError(LB::Xml::ERR_WRITE_FAILED, docRequest), saveError)};
+
+    // Record state of the written doc for the next import
+    QFileInfo savedDocInfo(mLaunchBoxInstall->getPlatformDocPath(plan.platform));
+    currentState.docSize = savedDocInfo.size();
+    currentState.docModified = savedDocInfo.lastModified().toMSecsSinceEpoch();
+    savePlatformState(currentState, plan.platform);
+
+    // Report successful platform completion
+    return {Successful, Qx::GenericError()};
+}
+
+ImportWorker::ImportResult ImportWorker::processGames(Qx::GenericError& errorReport, FP::Install::DBQueryBuffer& gameIDQuery, bool playlistSpecific)
+{
+    // Platform jobs in flight
+    QList<QFuture<PlatformJobResult>> platformJobs;
+    ImportResult processStatus = Successful;
+    errorReport = Qx::GenericError();
+
+    // Wait for the oldest job and merge its result, keeping the first failure
+    auto settleJob = [&](){
+        PlatformJobResult jobResult = platformJobs.takeFirst().result();
+
+        if(jobResult.result == Failed && processStatus != Failed)
         {
-            errorReport = Qx::GenericError(Qx::GenericError::Critical,
-                                           LB::Xml::formatDataDocError(LB::Xml::ERR_WRITE_FAILED, docRequest), saveError);
-            return Failed;
+            processStatus = Failed;
+            errorReport = jobResult.errorReport;
+            mPlatformJobFailed = true;
         }
+        else if(jobResult.result == Canceled && processStatus == Successful)
+            processStatus = Canceled;
+    };
+
+    // Record a database error that stops the import
+    auto failOnQuery = [&](const QSqlError& queryError){
+        processStatus = Failed;
+        errorReport = Qx::GenericError(Qx::GenericError::Critical, MSG_FP_DB_UNEXPECTED_ERROR, queryError.text());
+        mPlatformJobFailed = true;
+    };
+
+    // Platform being read and the ID and dateModified of each of its games
+    QString currentPlatform;
+    QList<QPair<QUuid, QString>> platformGameStamps;
+
+    // Hand a platform off to the pool once all of its IDs are known, then feed it whatever has to be read in full
+    auto finishPlatform = [&](){
+        // Only start another job once the pool has a thread for it
+        while(processStatus == Successful && platformJobs.size() >= mPlatformPool.maxThreadCount())
+            settleJob();
+
+        if(processStatus != Successful)
+            return;
+
+        PlatformPlan plan = planPlatform(currentPlatform, platformGameStamps, playlistSpecific);
+        std::shared_ptr<PlatformFeed> platformFeed = std::make_shared<PlatformFeed>();
+        platformJobs.append(QtConcurrent::run(&mPlatformPool, [this, plan, feed = platformFeed](){
+            PlatformJobResult jobResult = processPlatform(plan, feed);
+
+            // Stop other jobs and the reader early on failure, and don't leave the reader waiting on this job
+            if(jobResult.result == Failed)
+                mPlatformJobFailed = true;
+            feed->abandon();
 
+            return jobResult;
+        }));
+
+        // Read the games that changed, an incomplete platform is left as is by its job
+        QSqlError queryError = plan.upToDate ? QSqlError() : feedPlatform(*platformFeed, plan);
+        if(queryError.isValid())
+            failOnQuery(queryError);
+
+        platformFeed->close(!queryError.isValid() && !mCanceled && !mPlatformJobFailed);
+    };
+
+    // Read game IDs on this thread since it owns the database connection, splitting the ordered stream at platform boundaries
+    while(processStatus == Successful && !mCanceled && !mPlatformJobFailed && gameIDQuery.result.next())
+    {
+        QString platform = gameIDQuery.result.value(1).toString();
+
+        // Check for start of next platform
+        if(!platformGameStamps.isEmpty() && platform != currentPlatform)
+        {
+            finishPlatform();
+            platformGameStamps.clear();
+        }
+
+        currentPlatform = platform;
+        platformGameStamps.append({QUuid(gameIDQuery.result.value(0).toString()), gameIDQuery.result.value(2).toString()});
     }
 
-    // Report successful step completion
-    errorReport = Qx::GenericError();
-    return Successful;
+    // Finish the last platform
+    if(processStatus == Successful && !mCanceled && !mPlatformJobFailed)
+    {
+        if(gameIDQuery.result.lastError().isValid())
+            failOnQuery(gameIDQuery.result.lastError());
+        else if(!platformGameStamps.isEmpty())
+            finishPlatform();
+    }
+
+    // Wait for remaining jobs
+    while(!platformJobs.isEmpty())
+        settleJob();
+
+    // Wait for images still being transferred
+    finishImageTransfers();
+
+    // Report step status
+    if(processStatus == Successful && mCanceled)
+        processStatus = Canceled;
+
+    return processStatus;
 }
 
 ImportWorker::ImportResult ImportWorker::setImageReferences(Qx::GenericError& errorReport, QStringList platforms)
@@ -318,18 +754,35 @@ ImportWorker::ImportResult ImportWorker::setImageReferences(Qx::GenericError& er
 
 ImportWorker::ImportResult ImportWorker::processPlaylists(Qx::GenericError& errorReport, QList<FP::Install::DBQueryBuffer>& playlistGameQueries)
 {
-    for(FP::Install::DBQueryBuffer& currentPlaylistGameResult : playlistGameQueries)
+    // Existing playlist docs are read ahead on the pool while earlier playlists are merged (waits on any still reading when leaving)
+    std::vector<PlaylistDocPrefetch> prefetches(playlistGameQueries.size());
+    int nextPrefetch = 0;
+
+    for(int i = 0; i < playlistGameQueries.size(); i++)
     {
+        FP::Install::DBQueryBuffer& currentPlaylistGameResult = playlistGameQueries[i];
+
+        // Keep the next docs reading
+        for(; nextPrefetch < playlistGameQueries.size() && nextPrefetch <= i + PLAYLIST_PREFETCH_COUNT; nextPrefetch++)
+        {
+            PlaylistDocPrefetch* prefetch = &prefetches[nextPrefetch];
+            QString title = mPlaylistsCache.value(QUuid(playlistGameQueries[nextPrefetch].source)).getTitle();
+            prefetch->job = QtConcurrent::run(&mPlatformPool, [this, prefetch, title]{
+                prefetch->readError = mLaunchBoxInstall->openPlaylistDoc(prefetch->doc, title, mOptionSet.updateOptions);
+            });
+        }
+
         // Get corresponding playlist from cache
         FP::Playlist currentPlaylist = mPlaylistsCache.value(QUuid(currentPlaylistGameResult.source));
 
         // Update progress dialog label
         emit progressStepChanged(STEP_IMPORTING_PLAYLIST_GAMES.arg(currentPlaylist.getTitle()));
 
-        // Open LB playlist doc
+        // Take LB playlist doc once it has been read
         LB::Xml::DataDocHandle docRequest = {LB::Xml::PlaylistDoc::TYPE_NAME, currentPlaylist.getTitle()};
-        std::unique_ptr<LB::Xml::PlaylistDoc> currentPlaylistXML;
-        Qx::XmlStreamReaderError playlistReadError = mLaunchBoxInstall->openPlaylistDoc(currentPlaylistXML, docRequest.docName, mOptionSet.updateOptions);
+        prefetches[i].job.waitForFinished();
+        std::unique_ptr<LB::Xml::PlaylistDoc> currentPlaylistXML = std::move(prefetches[i].doc);
+        Qx::XmlStreamReaderError playlistReadError = prefetches[i].readError;
 
         // Stop import if error occured
         if(playlistReadError.isValid())
@@ -343,24 +796,14 @@ ImportWorker::ImportResult ImportWorker::processPlaylists(Qx::GenericError& erro
         currentPlaylistXML->setPlaylistHeader(LB::PlaylistHeader(currentPlaylist));
 
         // Add/Update playlist games
-        for(int i = 0; i < currentPlaylistGameResult.size; i++)
+        while(currentPlaylistGameResult.result.next())
         {
-            // Advance to next record
-            currentPlaylistGameResult.result.next();
+            // Form playlist game from record
+            FP::PlaylistGame playlistGame = FP::Install::playlistGameFromRecord(currentPlaylistGameResult.result);
 
             // Only process the playlist game if it was included in import
-            if(mPlaylistGameDetailsCache.contains(QUuid(currentPlaylistGameResult.result.value(FP::Install::DBTable_Playlist_Game::COL_GAME_ID).toString())))
-            {
-                // Form game from record
-                FP::PlaylistGameBuilder fpPgb;
-                fpPgb.wID(currentPlaylistGameResult.result.value(FP::Install::DBTable_Playlist_Game::COL_ID).toString());
-                fpPgb.wPlaylistID(currentPlaylistGameResult.result.value(FP::Install::DBTable_Playlist_Game::COL_PLAYLIST_ID).toString());
-                fpPgb.wOrder(currentPlaylistGameResult.result.value(FP::Install::DBTable_Playlist_Game::COL_ORDER).toString());
-                fpPgb.wGameID(currentPlaylistGameResult.result.value(FP::Install::DBTable_Playlist_Game::COL_GAME_ID).toString());
-
-                // Build FP playlist game, convert to LB and add
-                currentPlaylistXML->addPlaylistGame(LB::PlaylistGame(fpPgb.build(), mPlaylistGameDetailsCache));
-            }
+            if(mPlaylistGameDetailsCache.contains(playlistGame.getGameID()))
+                currentPlaylistXML->addPlaylistGame(LB::PlaylistGame(playlistGame, mPlaylistGameDetailsCache)); // Convert to LB and add
 
             // Update progress dialog value
             if(mCanceled)
@@ -369,7 +812,7 @@ ImportWorker::ImportResult ImportWorker::processPlaylists(Qx::GenericError& erro
                 return Canceled;
             }
             else
-                emit progressValueChanged(++mCurrentProgressValue);
+                advanceProgress();
         }
 
         // Finalize document
@@ -390,8 +833,7 @@ ImportWorker::ImportResult ImportWorker::processPlaylists(Qx::GenericError& erro
     return Successful;
 }
 
-//Public
-ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
+ImportWorker::ImportResult ImportWorker::processImport(Qx::GenericError& errorReport)
 {
     // Import step status
     ImportResult importStepStatus;
@@ -400,9 +842,10 @@ ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
     QSqlError queryError;
 
     // Initial query buffers
-    QList<FP::Install::DBQueryBuffer> gameQueries;
-    QList<FP::Install::DBQueryBuffer> playlistSpecGameQueries;
-    FP::Install::DBQueryBuffer addAppQuery;
+    FP::Install::DBQueryBuffer gameIDQuery;
+    FP::Install::DBQueryBuffer playlistSpecGameIDQuery;
+    QHash<QString, int> gameCounts;
+    QHash<QString, int> playlistSpecGameCounts;
     FP::Install::DBQueryBuffer playlistQueries;
     QList<FP::Install::DBQueryBuffer> playlistGameQueries;
 
@@ -417,8 +860,10 @@ ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
     // Pre-load Playlists, add to cache and create ID list
     const QList<QUuid> targetPlaylistIDs = preloadPlaylists(playlistQueries);
 
-    // Make initial game query
-    queryError = mFlashpointInstall->queryGamesByPlatform(gameQueries, mImportSelections.platforms, mOptionSet.inclusionOptions);
+    // Make initial game queries
+    queryError = mFlashpointInstall->queryGameCountsByPlatform(gameCounts, mImportSelections.platforms, mOptionSet.inclusionOptions);
+    if(!queryError.isValid())
+        queryError = mFlashpointInstall->queryGameIDsByPlatform(gameIDQuery, mImportSelections.platforms, mOptionSet.inclusionOptions);
     if(queryError.isValid())
     {
         errorReport = Qx::GenericError(Qx::GenericError::Critical, MSG_FP_DB_UNEXPECTED_ERROR, queryError.text());
@@ -428,27 +873,24 @@ ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
     // Make initial playlist specific game query if applicable
     if(mOptionSet.playlistMode == LB::Install::PlaylistGameMode::ForceAll)
     {
-        FP::Install::DBQueryBuffer pgIDQuery;
-
-        // Make playlist game ID query
-        queryError = mFlashpointInstall->queryPlaylistGameIDs(pgIDQuery, targetPlaylistIDs);
+        // Load playlist game IDs into the database side filter
+        queryError = mFlashpointInstall->loadPlaylistGameIDFilter(targetPlaylistIDs);
         if(queryError.isValid())
         {
             errorReport = Qx::GenericError(Qx::GenericError::Critical, MSG_FP_DB_UNEXPECTED_ERROR, queryError.text());
             return Failed;
         }
 
-        // Get playlist game ID list
-        const QList<QUuid> targetPlaylistGameIDs = getPlaylistSpecificGameIDs(pgIDQuery);
-
         // Make unselected platforms list
         QStringList availablePlatforms = mFlashpointInstall->getPlatformList();
         QStringList unselectedPlatforms = QStringList(availablePlatforms);
         for(const QString& selPlatform : mImportSelections.platforms)
             unselectedPlatforms.removeAll(selPlatform);
 
-        // Make game query
-        queryError = mFlashpointInstall->queryGamesByPlatform(playlistSpecGameQueries, unselectedPlatforms, mOptionSet.inclusionOptions, targetPlaylistGameIDs);
+        // Make game queries
+        queryError = mFlashpointInstall->queryGameCountsByPlatform(playlistSpecGameCounts, unselectedPlatforms, mOptionSet.inclusionOptions, true);
+        if(!queryError.isValid())
+            queryError = mFlashpointInstall->queryGameIDsByPlatform(playlistSpecGameIDQuery, unselectedPlatforms, mOptionSet.inclusionOptions, true);
         if(queryError.isValid())
         {
             errorReport = Qx::GenericError(Qx::GenericError::Critical, MSG_FP_DB_UNEXPECTED_ERROR, queryError.text());
@@ -456,14 +898,6 @@ ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
         }
     }
 
-    // Make initial add apps query
-    queryError = mFlashpointInstall->queryAllAddApps(addAppQuery);
-    if(queryError.isValid())
-    {
-        errorReport = Qx::GenericError(Qx::GenericError::Critical, MSG_FP_DB_UNEXPECTED_ERROR, queryError.text());
-        return Failed;
-    }
-
     // Make initial playlist games query
     queryError = mFlashpointInstall->queryPlaylistGamesByPlaylist(playlistGameQueries, targetPlaylistIDs);
     if(queryError.isValid())
@@ -472,31 +906,25 @@ ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
        return Failed;
     }
 
-    // Determine workload
+    // Determine workload (additional apps are added per platform as they are read)
     mCurrentProgressValue = 0;
-    mMaximumProgressValue = addAppQuery.size; // Additional App pre-load
-    for(const FP::Install::DBQueryBuffer& query : gameQueries) // All games
-        mMaximumProgressValue += query.size;
-    for(const FP::Install::DBQueryBuffer& query : playlistSpecGameQueries) // All playlist specific games
-        mMaximumProgressValue += query.size;
+    mMaximumProgressValue = 0;
+    for(int platformCount : qAsConst(gameCounts)) // All games
+        mMaximumProgressValue += platformCount;
+    for(int platformCount : qAsConst(playlistSpecGameCounts)) // All playlist specific games
+        mMaximumProgressValue += platformCount;
     for(const FP::Install::DBQueryBuffer& query : playlistGameQueries) // All playlist games
         mMaximumProgressValue += query.size;
-    mMaximumProgressValue += addAppQuery.size * gameQueries.size() + addAppQuery.size * playlistSpecGameQueries.size(); // All checks of Additional Apps
 
     // Re-prep progress dialog
     emit progressMaximumChanged(mMaximumProgressValue);
-    emit progressStepChanged(STEP_ADD_APP_PRELOAD);
-
-    // Pre-load additional apps
-    if((importStepStatus = preloadAddApps(errorReport, addAppQuery)) != Successful)
-        return importStepStatus;
 
     // Process games and additional apps by platform
-    if((importStepStatus = processGames(errorReport, gameQueries, false)) != Successful)
+    if((importStepStatus = processGames(errorReport, gameIDQuery, false)) != Successful)
         return importStepStatus;
 
     // Process playlist specific games and additional apps by platform
-    if((importStepStatus = processGames(errorReport, playlistSpecGameQueries, true)) != Successful)
+    if((importStepStatus = processGames(errorReport, playlistSpecGameIDQuery, true)) != Successful)
         return importStepStatus;
 
     // Set image references if applicable
@@ -505,12 +933,8 @@ ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
         // Update progress dialog label
         emit progressStepChanged(STEP_SETTING_IMAGE_REFERENCES);
 
-        // Create playlist pecific platforms set
-        QStringList playlistSpecPlatforms;
-        for(const FP::Install::DBQueryBuffer& query : playlistSpecGameQueries)
-            playlistSpecPlatforms.append(query.source);
-
-        if((importStepStatus = setImageReferences(errorReport, mImportSelections.platforms + playlistSpecPlatforms)) != Successful)
+        // Include platforms that only have playlist specific games
+        if((importStepStatus = setImageReferences(errorReport, mImportSelections.platforms + playlistSpecGameCounts.keys())) != Successful)
             return importStepStatus;
     }
 
@@ -535,4 +959,44 @@ ImportWorker::ImportResult ImportWorker::doImport(Qx::GenericError& errorReport)
 
 //-Slots---------------------------------------------------------------------------------------------------------
 //Public Slots:
+void ImportWorker::doImport()
+{
+    // Import error tracker
+    Qx::GenericError errorReport;
+
+    // Open a connection to the Flashpoint database for this thread, tuned for bulk reads
+    QSqlError connectError = mFlashpointInstall->openThreadDatabaseConnection(FP::Install::ConnectionProfile::BulkRead);
+    if(connectError.isValid())
+    {
+        errorReport = Qx::GenericError(Qx::GenericError::Critical, MSG_FP_DB_CANT_CONNECT, connectError.text());
+        emit importCompleted(Failed, errorReport);
+        return;
+    }
+
+    // Start a fresh tally of how images are copied, left empty when they're referenced
+    mLaunchBoxInstall->resetImageCopyCounts();
+
+    // Load digests of previously checked images and list which images Flashpoint has
+    if(mOptionSet.imageMode != LB::Install::Reference)
+    {
+        mLaunchBoxInstall->loadImageDigestCache();
+
+        emit progressStepChanged(STEP_SCANNING_IMAGES);
+        mLaunchBoxInstall->scanImageSources({mFlashpointInstall->getLogosDirectory(), mFlashpointInstall->getScrenshootsDirectory()});
+    }
+
+    // Perform import (all query buffers are released before the connection is closed)
+    ImportResult importResult = processImport(errorReport);
+
+    // Keep image digests for the next import (they stay valid even if this one is reverted, as they're checked against the files)
+    if(mOptionSet.imageMode != LB::Install::Reference)
+        mLaunchBoxInstall->saveImageDigestCache();
+
+    // Release this thread's database connection
+    mFlashpointInstall->closeThreadedDatabaseConnection();
+
+    // Forward result
+    emit importCompleted(importResult, errorReport);
+}
+
 void ImportWorker::notifyCanceled() { mCanceled = true; }
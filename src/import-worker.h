@@ -3,6 +3,14 @@
 
 #include <QObject>
 #include <QMessageBox>
+#include <QThreadPool>
+#include <QMutex>
+#include <QSemaphore>
+#include <QWaitCondition>
+#include <QQueue>
+#include <QFuture>
+#include <QDataStream>
+#include <atomic>
 #include "flashpoint-install.h"
 #include "launchbox-install.h"
 
@@ -30,16 +38,127 @@ public:
         FP::Install::InclusionOptions inclusionOptions;
     };
 
+private:
+    struct PlatformJobResult
+    {
+        ImportResult result;
+        Qx::GenericError errorReport;
+    };
+
+    struct ImportedGame
+    {
+        QByteArray digest;
+        QList<QUuid> addAppIDs;
+
+        friend QDataStream& operator<< (QDataStream& stream, const ImportedGame& game)
+        {
+            return stream << game.digest << game.addAppIDs;
+        }
+
+        friend QDataStream& operator>> (QDataStream& stream, ImportedGame& game)
+        {
+            return stream >> game.digest >> game.addAppIDs;
+        }
+    };
+
+    struct PlatformImportState
+    {
+        QByteArray optionsDigest; // Options the platform was last imported with
+        qint64 docSize; // Platform doc as it was last written
+        qint64 docModified;
+        QString dateModifiedMark; // Newest game dateModified imported, as stored in the database
+        QHash<QUuid, ImportedGame> games;
+        QHash<QUuid, QByteArray> addAppDigests;
+        QHash<QUuid, LB::PlaylistGame::EntryDetails> docGameDetails; // Every game in the doc, obsolete ones included
+
+        friend QDataStream& operator<< (QDataStream& stream, const PlatformImportState& state)
+        {
+            return stream << state.optionsDigest << state.docSize << state.docModified << state.dateModifiedMark << state.games
+                          << state.addAppDigests << state.docGameDetails;
+        }
+
+        friend QDataStream& operator>> (QDataStream& stream, PlatformImportState& state)
+        {
+            return stream >> state.optionsDigest >> state.docSize >> state.docModified >> state.dateModifiedMark >> state.games
+                          >> state.addAppDigests >> state.docGameDetails;
+        }
+    };
+
+    struct PlatformPlan
+    {
+        QString platform;
+        bool playlistSpecific;
+        QByteArray optionsDigest;
+        QString dateModifiedMark; // Newest of the platform's games
+
+        // Set when the previous import can be built on
+        bool incremental;
+        bool upToDate; // Nothing was added, modified or removed since, so the doc is left as is
+        PlatformImportState previousState;
+        QString modifiedAfter; // Games modified after this are read again, null to read all
+        QList<QUuid> keptGameIDs; // Copied from the existing doc along with their additional apps
+        QList<QUuid> addedGameIDs; // New to the platform but not modified since, read one by one
+    };
+
+    struct PlaylistDocPrefetch
+    {
+        std::unique_ptr<LB::Xml::PlaylistDoc> doc;
+        Qx::XmlStreamReaderError readError;
+        QFuture<void> job;
+
+        ~PlaylistDocPrefetch() { job.waitForFinished(); }
+    };
+
+//-Inner Classes-------------------------------------------------------------------------------------------------
+private:
+    // Hands a platform's games, then its additional apps, from the reading thread to the platform's job in batches
+    class PlatformFeed
+    {
+    //-Class Structs-------------------------------------------------------------------------------------------------------
+    public:
+        struct Batch
+        {
+            QList<FP::Game> games;
+            QList<FP::AddApp> addApps;
+        };
+
+    //-Instance Variables--------------------------------------------------------------------------------------------------
+    private:
+        mutable QMutex mMutex;
+        QWaitCondition mBatchAdded;
+        QWaitCondition mBatchTaken;
+        QQueue<Batch> mBatches;
+        bool mClosed;
+        bool mComplete; // Whole platform was read
+        bool mAbandoned; // Job stopped taking batches
+
+    //-Constructor--------------------------------------------------------------------------------------------------------
+    public:
+        PlatformFeed();
+
+    //-Instance Functions-------------------------------------------------------------------------------------------------
+    public:
+        // Reader side
+        void put(Batch batch); // Waits while the job is PLATFORM_FEED_DEPTH batches behind
+        void close(bool complete);
+
+        // Job side
+        bool take(Batch& batchBuffer); // Waits for the next batch, false once there are no more
+        void abandon();
+        bool isComplete() const;
+    };
+
 //-Class Variables-----------------------------------------------------------------------------------------------
 public:
     // Import Steps
-    static inline const QString STEP_ADD_APP_PRELOAD = "Pre-loading Additional Apps...";
     static inline const QString STEP_IMPORTING_PLATFORM_GAMES = "Importing games for platform %1...";
     static inline const QString STEP_IMPORTING_PLAYLIST_SPEC_GAMES = "Importing playlist specific games for platform %1...";
     static inline const QString STEP_IMPORTING_PLATFORM_ADD_APPS = "Importing additional apps for platform %1...";
     static inline const QString STEP_IMPORTING_PLAYLIST_SPEC_ADD_APPS = "Importing playlist specific additional apps for platform %1...";
     static inline const QString STEP_IMPORTING_PLAYLIST_GAMES = "Importing playlist %1...";
     static inline const QString STEP_SETTING_IMAGE_REFERENCES = "Setting image references...";
+    static inline const QString STEP_FINISHING_IMAGE_TRANSFERS = "Finishing image transfers...";
+    static inline const QString STEP_SCANNING_IMAGES = "Scanning Flashpoint images...";
 
     // Import Errors
     static inline const QString MSG_FP_DB_CANT_CONNECT = "Failed to establish a handle to the Flashpoint database:";
@@ -49,6 +168,18 @@ public:
     // Error Captions
     static inline const QString CAPTION_IMAGE_ERR = "Error importing game image(s)";
 
+    // Import state
+    static inline const QString IMPORT_STATE_FOLDER_NAME = "import-state"; // Under the user app data location
+    static inline const QString IMPORT_STATE_EXT = ".state";
+    static inline const quint32 IMPORT_STATE_VERSION = 3;
+
+    // Limits
+    static inline const int GAME_BATCH_SIZE = 5000; // Games or additional apps handed to a platform job at once
+    static inline const int PLATFORM_FEED_DEPTH = 2; // Batches read ahead of a platform job before waiting on it
+    static inline const int PLAYLIST_PREFETCH_COUNT = 4; // Playlist docs read ahead of the one being merged
+    static inline const int IMAGE_TRANSFER_THREAD_COUNT = 8; // Transfers are bound by disk latency rather than CPU
+    static inline const int IMAGE_TRANSFER_QUEUE_LIMIT = 2048; // Games with images waiting on a transfer thread before platform jobs wait
+
 //-Instance Variables--------------------------------------------------------------------------------------------
 private:
     // Install links
@@ -60,19 +191,28 @@ private:
     OptionSet mOptionSet;
 
     // Job Caches
-    QSet<FP::AddApp> mAddAppsCache;
     QHash<QUuid, FP::Playlist> mPlaylistsCache;
     QHash<QUuid, LB::PlaylistGame::EntryDetails> mPlaylistGameDetailsCache;
+    QMutex mPlaylistGameDetailsMutex;
+
+    // Platform Processing
+    QThreadPool mPlatformPool;
+
+    // Image Transfer
+    QSemaphore mImageTransferSlots{IMAGE_TRANSFER_QUEUE_LIMIT};
+    QThreadPool mImageTransferPool;
 
     // Progress Tracking
-    int mCurrentProgressValue;
-    int mMaximumProgressValue;
+    std::atomic_int mCurrentProgressValue;
+    std::atomic_int mMaximumProgressValue; // Grows as additional apps are read
 
     // Cancel Status
-    bool mCanceled = false;
+    std::atomic_bool mCanceled = false; // Set from the GUI thread, polled from the import thread
+    std::atomic_bool mPlatformJobFailed = false; // Stops remaining platform jobs after one fails
 
     // Error Tracking
     std::shared_ptr<int> mBlockingErrorResponse = std::make_shared<int>();
+    QMutex mBlockingErrorMutex;
 
 //-Constructor---------------------------------------------------------------------------------------------------
 public:
@@ -81,20 +221,35 @@ public:
                  ImportSelections importSelections,
                  OptionSet optionSet);
 
+//-Class Functions-----------------------------------------------------------------------------------------------------------
+private:
+    template<typename Entry>
+    static QByteArray entryDigest(const Entry& entry);
+
 //-Instance Functions---------------------------------------------------------------------------------------------------------
 private:
     const QList<QUuid> preloadPlaylists(FP::Install::DBQueryBuffer& playlistQuery);
-    const QList<QUuid> getPlaylistSpecificGameIDs(FP::Install::DBQueryBuffer& playlistGameIDQuery);
-    ImportResult preloadAddApps(Qx::GenericError& errorReport, FP::Install::DBQueryBuffer& addAppQuery);
-    ImportResult processGames(Qx::GenericError& errorReport, QList<FP::Install::DBQueryBuffer>& gameQueries, bool playlistSpecific);
+    int postBlockingError(Qx::GenericError blockingError, QMessageBox::StandardButtons choices, int defaultChoice);
+    QByteArray optionsDigest(bool playlistSpecific) const;
+    QString platformStatePath(QString platform) const;
+    bool loadPlatformState(PlatformImportState& stateBuffer, QString platform) const;
+    void savePlatformState(const PlatformImportState& state, QString platform) const;
+    void advanceProgress(int steps = 1);
+    void transferGameImages(const LB::Game& game);
+    void queueImageTransfer(const LB::Game& game);
+    void finishImageTransfers();
+    void checkKeptGameImages(QUuid gameID, QString platform);
+    PlatformPlan planPlatform(QString platform, const QList<QPair<QUuid, QString>>& gameStamps, bool playlistSpecific) const;
+    QSqlError feedPlatform(PlatformFeed& platformFeed, const PlatformPlan& plan);
+    PlatformJobResult processPlatform(const PlatformPlan& plan, std::shared_ptr<PlatformFeed> platformFeed);
+    ImportResult processGames(Qx::GenericError& errorReport, FP::Install::DBQueryBuffer& gameIDQuery, bool playlistSpecific);
     ImportResult setImageReferences(Qx::GenericError& errorReport, QStringList platforms);
     ImportResult processPlaylists(Qx::GenericError& errorReport, QList<FP::Install::DBQueryBuffer>& playlistGameQueries);
-
-public:
-    ImportResult doImport(Qx::GenericError& errorReport);
+    ImportResult processImport(Qx::GenericError& errorReport);
 
 //-Slots----------------------------------------------------------------------------------------------------------
 public slots:
+    void doImport();
     void notifyCanceled();
 
 //-Signals---------------------------------------------------------------------------------------------------------
@@ -1,6 +1,10 @@
 #include "launchbox-install.h"
 #include <QFileInfo>
 #include <QDir>
+#include <QDirIterator>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QCryptographicHash>
 #include <qhashfunctions.h>
 #include <filesystem>
 
@@ -9,6 +13,9 @@
 #include "Aclapi.h"
 #include "sddl.h"
 
+// Specifically for cloning images
+#include <winioctl.h>
+
 namespace LB
 {
 
@@ -65,6 +72,139 @@ void Install::allowUserWriteOnXML(QString xmlPath)
     xmlPathC.ReleaseBuffer();
 }
 
+QString Install::makeBackupPath(const QFileInfo& fileInfo) { return fileInfo.absolutePath() + '/' + fileInfo.baseName() + MODIFIED_FILE_EXT; }
+
+bool Install::cloneImage(bool& cloningUnsupported, QString sourcePath, QString destinationPath)
+{
+    // Shares the source's clusters with the new file (ReFS/Dev Drive), so no image data is read or written
+    cloningUnsupported = false;
+
+    std::wstring nativeSourcePath = QDir::toNativeSeparators(sourcePath).toStdWString();
+    std::wstring nativeDestinationPath = QDir::toNativeSeparators(destinationPath).toStdWString();
+
+    HANDLE source = CreateFileW(nativeSourcePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(source == INVALID_HANDLE_VALUE)
+        return false;
+
+    HANDLE destination = CreateFileW(nativeDestinationPath.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(destination == INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(source);
+        return false;
+    }
+
+    auto clone = [&]() -> bool {
+        // Both files must be on the same volume, and it must support block cloning
+        BY_HANDLE_FILE_INFORMATION sourceInfo;
+        BY_HANDLE_FILE_INFORMATION destinationInfo;
+        DWORD volumeFlags;
+        if(!GetFileInformationByHandle(source, &sourceInfo) || !GetFileInformationByHandle(destination, &destinationInfo) ||
+           !GetVolumeInformationByHandleW(destination, NULL, 0, NULL, NULL, &volumeFlags, NULL, 0))
+            return false;
+
+        if(sourceInfo.dwVolumeSerialNumber != destinationInfo.dwVolumeSerialNumber || !(volumeFlags & FILE_SUPPORTS_BLOCK_REFCOUNTING))
+        {
+            cloningUnsupported = true;
+            return false;
+        }
+
+        // Match the source's sparseness and integrity settings, which cloning requires
+        DWORD bytesReturned;
+        if((sourceInfo.dwFileAttributes & FILE_ATTRIBUTE_SPARSE_FILE) &&
+           !DeviceIoControl(destination, FSCTL_SET_SPARSE, NULL, 0, NULL, 0, &bytesReturned, NULL))
+            return false;
+
+        FSCTL_GET_INTEGRITY_INFORMATION_BUFFER integrityInfo;
+        if(!DeviceIoControl(source, FSCTL_GET_INTEGRITY_INFORMATION, NULL, 0, &integrityInfo, sizeof(integrityInfo), &bytesReturned, NULL))
+        {
+            cloningUnsupported = true;
+            return false;
+        }
+
+        FSCTL_SET_INTEGRITY_INFORMATION_BUFFER destinationIntegrity = {integrityInfo.ChecksumAlgorithm, integrityInfo.Reserved, integrityInfo.Flags};
+        if(!DeviceIoControl(destination, FSCTL_SET_INTEGRITY_INFORMATION, &destinationIntegrity, sizeof(destinationIntegrity), NULL, 0, &bytesReturned, NULL))
+            return false;
+
+        // Size destination, then clone whole clusters (the last may extend past the end of file)
+        LONGLONG fileSize = (LONGLONG(sourceInfo.nFileSizeHigh) << 32) | sourceInfo.nFileSizeLow;
+        FILE_END_OF_FILE_INFO endOfFile;
+        endOfFile.EndOfFile.QuadPart = fileSize;
+        if(!SetFileInformationByHandle(destination, FileEndOfFileInfo, &endOfFile, sizeof(endOfFile)))
+            return false;
+
+        LONGLONG clusterSize = integrityInfo.ClusterSizeInBytes;
+        LONGLONG cloneSize = (fileSize + clusterSize - 1) / clusterSize * clusterSize;
+
+        for(LONGLONG offset = 0; offset < cloneSize; offset += IMAGE_CLONE_CHUNK_SIZE)
+        {
+            DUPLICATE_EXTENTS_DATA extents;
+            extents.FileHandle = source;
+            extents.SourceFileOffset.QuadPart = offset;
+            extents.TargetFileOffset.QuadPart = offset;
+            extents.ByteCount.QuadPart = qMin<LONGLONG>(IMAGE_CLONE_CHUNK_SIZE, cloneSize - offset);
+
+            if(!DeviceIoControl(destination, FSCTL_DUPLICATE_EXTENTS_TO_FILE, &extents, sizeof(extents), NULL, 0, &bytesReturned, NULL))
+            {
+                cloningUnsupported = GetLastError() == ERROR_NOT_SUPPORTED || GetLastError() == ERROR_INVALID_FUNCTION;
+                return false;
+            }
+        }
+
+        // Keep the source's timestamps as a regular copy would, the up-to-date check relies on them
+        FILE_BASIC_INFO basicInfo;
+        if(!GetFileInformationByHandleEx(source, FileBasicInfo, &basicInfo, sizeof(basicInfo)))
+            return false;
+
+        basicInfo.FileAttributes = 0; // Leave unchanged
+        return SetFileInformationByHandle(destination, FileBasicInfo, &basicInfo, sizeof(basicInfo));
+    };
+
+    bool cloned = clone();
+
+    CloseHandle(source);
+    CloseHandle(destination);
+
+    // Don't leave a partial image behind
+    if(!cloned)
+        DeleteFileW(nativeDestinationPath.c_str());
+
+    return cloned;
+}
+
+Install::ImageFileState Install::statImage(QString imagePath)
+{
+    QFileInfo imageInfo(imagePath);
+    return {imageInfo.exists() && (imageInfo.isFile() || imageInfo.isSymLink()), imageInfo.isSymLink(), imageInfo.size(),
+            imageInfo.lastModified().toMSecsSinceEpoch()};
+}
+
+QHash<QUuid, Install::ImageFileState> Install::scanImageDirectory(QDir imageDir, bool idSubfolders)
+{
+    // Details come with the directory listing itself (FindFirstFileEx), so no file is opened or stat'ed individually
+    QHash<QUuid, ImageFileState> scannedImages;
+    QDirIterator imageItr(imageDir.absolutePath(), {'*' + IMAGE_EXT}, QDir::Files | QDir::System,
+                          idSubfolders ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags);
+
+    while(imageItr.hasNext())
+    {
+        imageItr.next();
+        QFileInfo imageInfo = imageItr.fileInfo();
+
+        // Only images named after a game, in the folder its path is built with
+        QString imageName = imageInfo.completeBaseName();
+        QUuid gameID = QUuid::fromString(imageName);
+        if(gameID.isNull())
+            continue;
+
+        if(idSubfolders && imageInfo.path() != imageDir.absolutePath() + '/' + imageName.left(2) + '/' + imageName.mid(2, 2))
+            continue;
+
+        scannedImages[gameID] = {true, imageInfo.isSymLink(), imageInfo.size(), imageInfo.lastModified().toMSecsSinceEpoch()};
+    }
+
+    return scannedImages;
+}
+
 QString Install::makeFileNameLBKosher(QString fileName)
 {
     // Perform general kosherization
@@ -91,85 +231,249 @@ bool Install::pathIsValidInstall(QString installPath)
 
 //-Instance Functions----------------------------------------------------------------------------------------------
 //Private:
+QString Install::imageDigestCachePath() const
+{
+    QByteArray installHash = QCryptographicHash::hash(mRootDirectory.absolutePath().toUtf8(), QCryptographicHash::Md5).toHex();
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + '/' + IMAGE_DIGEST_CACHE_NAME.arg(QString::fromLatin1(installHash));
+}
+
+bool Install::imageDigest(QByteArray& digestBuffer, QString imagePath, const ImageFileState& imageState)
+{
+    // Use cached digest if the file hasn't changed since it was hashed
+    mImageDigestMutex.lock();
+    QHash<QString, ImageDigest>::const_iterator cached = mImageDigests.constFind(imagePath);
+    bool cacheHit = cached != mImageDigests.constEnd() && cached->size == imageState.size && cached->modified == imageState.modified;
+    if(cacheHit)
+        digestBuffer = cached->digest;
+    mImageDigestMutex.unlock();
+
+    if(cacheHit)
+        return true;
+
+    // Hash file and cache result
+    QFile image(imagePath);
+    if(!Qx::calculateFileChecksum(digestBuffer, image, QCryptographicHash::Md5).wasSuccessful())
+        return false;
+
+    QMutexLocker digestLocker(&mImageDigestMutex);
+    mImageDigests[imagePath] = ImageDigest{imageState.size, imageState.modified, digestBuffer};
+    return true;
+}
+
+bool Install::imageIsCurrent(QString sourcePath, ImageFileState sourceState, QString destinationPath, ImageFileState destinationState)
+{
+    // Compare the files links point to
+    if(sourceState.symLink)
+        sourceState = statImage(sourcePath);
+    if(destinationState.symLink)
+        destinationState = statImage(destinationPath);
+
+    // Size differs, so content does
+    if(sourceState.size != destinationState.size)
+        return false;
+
+    // Same size and modification time, as left by a previous copy
+    if(sourceState.modified == destinationState.modified)
+        return true;
+
+    // Compare content, only hashing files that changed since they were last hashed
+    QByteArray sourceChecksum;
+    QByteArray destinationChecksum;
+    return imageDigest(sourceChecksum, sourcePath, sourceState) && imageDigest(destinationChecksum, destinationPath, destinationState) &&
+           sourceChecksum == destinationChecksum;
+}
+
+Install::ImagePaths Install::imagePaths(QDir sourceDir, QString destinationSubPath, QUuid gameID, QString platform) const
+{
+    // Sources are split into sub-folders by the first two pairs of ID characters
+    QString gameIDString = gameID.toString(QUuid::WithoutBraces);
+    ImagePaths paths;
+    paths.sourceDir = sourceDir.absolutePath();
+    paths.destinationDir = mPlatformImagesDirectory.absolutePath() + '/' + platform + '/' + destinationSubPath;
+    paths.source = paths.sourceDir + '/' + gameIDString.left(2) + '/' + gameIDString.mid(2, 2) + '/' + gameIDString + IMAGE_EXT;
+    paths.destination = paths.destinationDir + '/' + gameIDString + IMAGE_EXT;
+
+    return paths;
+}
+
+Install::ImageFileState Install::imageFileState(QString imageDir, QUuid gameID, QString imagePath)
+{
+    // Use pre-scan if the directory was scanned, where missing images cost nothing
+    QMutexLocker scanLocker(&mImageScanMutex);
+    QHash<QString, QHash<QUuid, ImageFileState>>::const_iterator scannedDir = mScannedImages.constFind(imageDir);
+    if(scannedDir != mScannedImages.constEnd())
+        return scannedDir->value(gameID, ImageFileState{false, false, 0, 0});
+
+    scanLocker.unlock();
+    return statImage(imagePath);
+}
+
+bool Install::scannedImageIsCurrent(ImageMode imageMode, QDir sourceDir, QString destinationSubPath, QUuid gameID, QString platform)
+{
+    ImagePaths paths = imagePaths(sourceDir, destinationSubPath, gameID, platform);
+    ImageFileState sourceState = imageFileState(paths.sourceDir, gameID, paths.source);
+    ImageFileState destinationState = imageFileState(paths.destinationDir, gameID, paths.destination);
+
+    // Nothing to transfer, or a link that transferImage() would leave as is
+    if(!sourceState.present || (destinationState.present && destinationState.symLink && imageMode == Link))
+        return true;
+
+    // Anything less than a plain match of size and modification time is left to transferImage() to look into
+    return destinationState.present && !sourceState.symLink && !destinationState.symLink &&
+           sourceState.size == destinationState.size && sourceState.modified == destinationState.modified;
+}
+
+void Install::recordTransferredImage(QString imageDir, QUuid gameID, const ImageFileState& imageState)
+{
+    // Keep the pre-scan of the directory accurate, unscanned directories are left as is
+    QMutexLocker scanLocker(&mImageScanMutex);
+    QHash<QString, QHash<QUuid, ImageFileState>>::iterator scannedDir = mScannedImages.find(imageDir);
+    if(scannedDir != mScannedImages.end())
+        scannedDir->insert(gameID, imageState);
+}
+
+bool Install::copyImage(QString sourcePath, QString destinationPath)
+{
+    // Try block cloning until the volumes are known not to support it
+    if(!mImageCloningUnsupported)
+    {
+        bool cloningUnsupported;
+        if(cloneImage(cloningUnsupported, sourcePath, destinationPath))
+        {
+            mClonedImageCount++;
+            return true;
+        }
+
+        if(cloningUnsupported)
+            mImageCloningUnsupported = true;
+    }
+
+    // Regular copy (CopyFile, performed by the system)
+    if(!QFile::copy(sourcePath, destinationPath))
+        return false;
+
+    mCopiedImageCount++;
+    return true;
+}
+
+bool Install::hardLinkImage(QString sourcePath, QString destinationPath)
+{
+    // Link while the images are known to be able to share a volume
+    if(!mImageHardLinkingUnsupported)
+    {
+        std::error_code linkError;
+        std::filesystem::create_hard_link(sourcePath.toStdWString(), destinationPath.toStdWString(), linkError);
+        if(!linkError)
+            return true;
+
+        if(linkError == std::errc::cross_device_link || linkError == std::errc::not_supported || linkError == std::errc::function_not_supported)
+            mImageHardLinkingUnsupported = true;
+    }
+
+    // Fallback to a copy, e.g. when Flashpoint and LaunchBox are on different drives
+    return copyImage(sourcePath, destinationPath);
+}
+
 QString Install::transferImage(ImageMode imageMode, QDir sourceDir, QString destinationSubPath, const LB::Game& game)
 {
     // Parse to paths
-    QString gameIDString = game.getID().toString(QUuid::WithoutBraces);
-    QString sourcePath = sourceDir.absolutePath() + '/' + gameIDString.left(2) + '/' + gameIDString.mid(2, 2) + '/' + gameIDString + IMAGE_EXT;
-    QString destinationPath = mPlatformImagesDirectory.absolutePath() + '/' + game.getPlatform() + '/' + destinationSubPath + '/' + gameIDString + IMAGE_EXT;
-
-    // Image info
-    QFileInfo destinationInfo(destinationPath);
-    QFileInfo sourceInfo(sourcePath);
-    bool destinationOccupied = destinationInfo.exists() && (destinationInfo.isFile() || destinationInfo.isSymLink());
-    bool sourceAvailable = sourceInfo.exists();
+    QUuid gameID = game.getID();
+    QString gameIDString = gameID.toString(QUuid::WithoutBraces);
+    ImagePaths paths = imagePaths(sourceDir, destinationSubPath, gameID, game.getPlatform());
+    QString sourceDirPath = paths.sourceDir;
+    QString destinationDirPath = paths.destinationDir;
+    QString sourcePath = paths.source;
+    QString destinationPath = paths.destination;
+
+    // Image info, from the pre-scans when available
+    ImageFileState sourceState = imageFileState(sourceDirPath, gameID, sourcePath);
+    if(sourceState.symLink)
+        sourceState = statImage(sourcePath); // Scans include broken links
+
+    // Nothing to do for games without the image
+    if(!sourceState.present)
+        return QString();
+
+    ImageFileState destinationState = imageFileState(destinationDirPath, gameID, destinationPath);
+    bool destinationOccupied = destinationState.present;
 
     // Return if image is already up-to-date
-    if(sourceAvailable && destinationOccupied)
+    if(destinationOccupied)
     {
-        if(destinationInfo.isSymLink() && imageMode == Link)
+        if(destinationState.symLink && imageMode == Link)
+            return QString();
+        else if(imageIsCurrent(sourcePath, sourceState, destinationPath, destinationState))
             return QString();
-        else
-        {
-            QFile source(sourcePath);
-            QFile destination(destinationPath);
-            QByteArray sourceChecksum;
-            QByteArray destinationChecksum;
-
-            if(Qx::calculateFileChecksum(sourceChecksum, source, QCryptographicHash::Md5).wasSuccessful() &&
-               Qx::calculateFileChecksum(destinationChecksum, destination, QCryptographicHash::Md5).wasSuccessful() &&
-               sourceChecksum == destinationChecksum)
-                return QString();
-        }
     }
 
     // Determine backup path
-    QString backupPath = destinationInfo.absolutePath() + '/' + destinationInfo.baseName() + MODIFIED_FILE_EXT;
+    QString backupPath = destinationDirPath + '/' + gameIDString + MODIFIED_FILE_EXT;
 
     // Temporarily backup image if it already exists (also acts as deletion marking in case images for the title were removed in an update)
-    if(destinationOccupied && sourceAvailable)
+    if(destinationOccupied)
         if(!QFile::rename(destinationPath, backupPath)) // Temp backup
             return ERR_IMAGE_WONT_BACKUP.arg(destinationPath);
 
     // Linking error tracker
     std::error_code linkError;
 
-    // Handle transfer if source is available
-    if(sourceAvailable)
+    // Handle transfer
+    switch(imageMode)
     {
-        switch(imageMode)
-        {
-            case Copy:
-                if(!QFile::copy(sourcePath, destinationPath))
-                {
-                    QFile::rename(backupPath, destinationPath); // Restore Backup
-                    return ERR_IMAGE_WONT_COPY.arg(sourcePath, destinationPath);
-                }
-                else if(QFile::exists(backupPath))
-                    QFile::remove(backupPath);
-                else
-                    mPurgableImages.append(destinationPath); // Only queue image to be removed on failure if its new, so existing images arent deleted on revert
-                break;
-
-            case Link:
-                std::filesystem::create_symlink(sourcePath.toStdString(), destinationPath.toStdString(), linkError);
-                if(linkError)
-                {
-                    QFile::rename(backupPath, destinationPath); // Restore Backup
-                    return ERR_IMAGE_WONT_LINK.arg(sourcePath, destinationPath);
-                }
-                else if(QFile::exists(backupPath))
-                    QFile::remove(backupPath);
-                else
-                    mPurgableImages.append(destinationPath); // Only queue image to be removed on failure if its new, so existing images arent deleted on revert
-                break;
-
-            case Reference:
-                throw std::runtime_error("transferImage() should not be called with imageMode Reference!");
-                break;
-        }
+        case Copy:
+            if(!copyImage(sourcePath, destinationPath))
+            {
+                QFile::rename(backupPath, destinationPath); // Restore Backup
+                return ERR_IMAGE_WONT_COPY.arg(sourcePath, destinationPath);
+            }
+            else if(destinationOccupied)
+                QFile::remove(backupPath);
+            else
+            {
+                QMutexLocker trackerLocker(&mTrackerMutex);
+                mPurgableImages.append(destinationPath); // Only queue image to be removed on failure if its new, so existing images arent deleted on revert
+            }
+            break;
+
+        case Link:
+            std::filesystem::create_symlink(sourcePath.toStdString(), destinationPath.toStdString(), linkError);
+            if(linkError)
+            {
+                QFile::rename(backupPath, destinationPath); // Restore Backup
+                return ERR_IMAGE_WONT_LINK.arg(sourcePath, destinationPath);
+            }
+            else if(destinationOccupied)
+                QFile::remove(backupPath);
+            else
+            {
+                QMutexLocker trackerLocker(&mTrackerMutex);
+                mPurgableImages.append(destinationPath); // Only queue image to be removed on failure if its new, so existing images arent deleted on revert
+            }
+            break;
+
+        case HardLink:
+            if(!hardLinkImage(sourcePath, destinationPath))
+            {
+                QFile::rename(backupPath, destinationPath); // Restore Backup
+                return ERR_IMAGE_WONT_HARD_LINK.arg(sourcePath, destinationPath);
+            }
+            else if(destinationOccupied)
+                QFile::remove(backupPath);
+            else
+            {
+                QMutexLocker trackerLocker(&mTrackerMutex);
+                mPurgableImages.append(destinationPath); // Only queue image to be removed on failure if its new, so existing images arent deleted on revert
+            }
+            break;
+
+        case Reference:
+            throw std::runtime_error("transferImage() should not be called with imageMode Reference!");
+            break;
     }
 
+    // Destination now matches the source
+    recordTransferredImage(destinationDirPath, gameID, {true, imageMode == Link || sourceState.symLink, sourceState.size, sourceState.modified});
+
     // Return null string on success
     return QString();
 }
@@ -179,50 +483,46 @@ Qx::XmlStreamReaderError Install::openDataDocument(Xml::DataDoc* docToOpen, Xml:
     // Error report to return
     Qx::XmlStreamReaderError openReadError; // Defaults to no error
 
-    // Check if existing instance is already allocated and set handle to null if so
-    if(mLeasedHandles.contains(docToOpen->getHandleTarget()))
+    // Check if existing instance is already allocated and reserve the handle if not
+    mTrackerMutex.lock();
+    bool alreadyLeased = mLeasedHandles.contains(docToOpen->getHandleTarget());
+    if(!alreadyLeased)
+        mLeasedHandles.insert(docToOpen->getHandleTarget());
+    mTrackerMutex.unlock();
+
+    if(alreadyLeased)
         openReadError = Qx::XmlStreamReaderError(Xml::formatDataDocError(Xml::ERR_DOC_ALREADY_OPEN, docToOpen->getHandleTarget()));
     else
     {
-        // Create backup if required
-        QFileInfo targetInfo(docToOpen->mDocumentFile->fileName());
-
-        if(targetInfo.exists() && targetInfo.isFile())
+        // Read existing file if present, it is left untouched until the replacement is saved
+        if(mExistingDocuments.contains(docToOpen->getHandleTarget()))
         {
-            QString backupPath = targetInfo.absolutePath() + '/' + targetInfo.baseName() + MODIFIED_FILE_EXT;
-
-            if(QFile::exists(backupPath) && QFileInfo(backupPath).isFile())
+            if(docToOpen->mDocumentFile->open(QFile::ReadOnly))
             {
-                if(!QFile::remove(backupPath))
-                    return Qx::XmlStreamReaderError(Xml::formatDataDocError(Xml::ERR_BAK_WONT_DEL, docToOpen->getHandleTarget()));
+                openReadError = docReader->readInto();
+                docToOpen->mDocumentFile->close();
             }
-
-            if(!QFile::copy(targetInfo.absoluteFilePath(), backupPath))
-                return Qx::XmlStreamReaderError(Xml::formatDataDocError(Xml::ERR_CANT_MAKE_BAK, docToOpen->getHandleTarget()));
+            else
+                openReadError = Qx::XmlStreamReaderError(Xml::formatDataDocError(Xml::ERR_DOC_CANT_OPEN, docToOpen->getHandleTarget())
+                                                         .arg(docToOpen->mDocumentFile->errorString()));
         }
 
-        // Add file to modified list
-        mModifiedXMLDocuments.append(targetInfo.absoluteFilePath());
-
-        // Open File
-        if(docToOpen->mDocumentFile->open(QFile::ReadWrite)) // Ensures that empty file is created if the target doesn't exist
+        // Open replacement, which is written to a temporary file beside the document
+        if(!openReadError.isValid())
         {
-            // Read existing file if present
-            if(mExistingDocuments.contains(docToOpen->getHandleTarget()))
-            {
-                openReadError = docReader->readInto();
-
-                // Clear file to prepare for writing
-                docToOpen->clearFile();
-            }
+            if(docToOpen->mDocumentSaveFile.open(QIODevice::WriteOnly))
+                docToOpen->mDocumentWriteDevice.open(QIODevice::WriteOnly);
+            else
+                openReadError = Qx::XmlStreamReaderError(Xml::formatDataDocError(Xml::ERR_DOC_CANT_OPEN, docToOpen->getHandleTarget())
+                                                         .arg(docToOpen->mDocumentSaveFile.errorString()));
+        }
 
-            // Add handle to lease set if no error occured while readding
-            if(!openReadError.isValid())
-                mLeasedHandles.insert(docToOpen->getHandleTarget());
+        // Release reservation if an error occured while opening or reading
+        if(openReadError.isValid())
+        {
+            QMutexLocker trackerLocker(&mTrackerMutex);
+            mLeasedHandles.remove(docToOpen->getHandleTarget());
         }
-        else
-            openReadError = Qx::XmlStreamReaderError(Xml::formatDataDocError(Xml::ERR_DOC_CANT_OPEN, docToOpen->getHandleTarget())
-                                                     .arg(docToOpen->mDocumentFile->errorString()));
     }
 
     // Return new handle
@@ -231,17 +531,54 @@ Qx::XmlStreamReaderError Install::openDataDocument(Xml::DataDoc* docToOpen, Xml:
 
 bool Install::saveDataDocument(QString& errorMessage, Xml::DataDoc* docToSave, Xml::DataDocWriter* docWriter)
 {
-    // Write to file
+    // Write to temporary file
     errorMessage = docWriter->writeOutOf();
 
-    // Close document file
-    docToSave->mDocumentFile->close();
+    // Leave the existing document as is if the new one is identical (the temporary file is discarded with the doc)
+    bool unchanged = errorMessage.isNull() && !docToSave->mExistingDigest.isEmpty() &&
+                     docToSave->mDocumentWriteDevice.digest() == docToSave->mExistingDigest;
 
-    // Set document perfmissions
-    allowUserWriteOnXML(docToSave->mDocumentFile->fileName());
+    // Swap in the new document, keeping the existing one as the backup
+    if(errorMessage.isNull() && !unchanged)
+    {
+        QString docPath = docToSave->mDocumentFile->fileName();
+        QString backupPath = makeBackupPath(QFileInfo(docPath));
+        bool docExists = QFile::exists(docPath);
+
+        // The backup is a second link to the existing document (a copy where links aren't supported), so the document itself stays in
+        // place until the new one is renamed over it
+        auto makeBackup = [&](){
+            std::error_code linkError;
+            std::filesystem::create_hard_link(docPath.toStdWString(), backupPath.toStdWString(), linkError);
+            return !linkError || QFile::copy(docPath, backupPath);
+        };
+
+        if(docExists && QFile::exists(backupPath) && !QFile::remove(backupPath))
+            errorMessage = Xml::formatDataDocError(Xml::ERR_BAK_WONT_DEL, docToSave->getHandleTarget());
+        else if(docExists && !makeBackup())
+            errorMessage = Xml::formatDataDocError(Xml::ERR_CANT_MAKE_BAK, docToSave->getHandleTarget());
+        else if(!docToSave->mDocumentSaveFile.commit()) // Flushes to disk before renaming over the document
+        {
+            errorMessage = docToSave->mDocumentSaveFile.errorString();
+            if(docExists)
+                QFile::remove(backupPath); // Document was left untouched
+        }
+        else
+        {
+            // Add file to modified list
+            mTrackerMutex.lock();
+            mModifiedXMLDocuments.append(docPath);
+            mTrackerMutex.unlock();
+
+            // Set document perfmissions
+            allowUserWriteOnXML(docPath);
+        }
+    }
 
     // Remove handle reservation
+    mTrackerMutex.lock();
     mLeasedHandles.remove(docToSave->getHandleTarget());
+    mTrackerMutex.unlock();
 
     // Return write status and let document ptr auto delete
     return errorMessage.isNull();
@@ -259,6 +596,52 @@ QSet<QString> Install::getExistingDocs(QString type) const
 }
 
 //Public:
+void Install::loadImageDigestCache()
+{
+    QMutexLocker digestLocker(&mImageDigestMutex);
+    mImageDigests.clear();
+
+    QFile cacheFile(imageDigestCachePath());
+    if(!cacheFile.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream cacheStream(&cacheFile);
+    cacheStream.setVersion(QDataStream::Qt_5_15);
+
+    // Check format version
+    quint32 cacheVersion = 0;
+    cacheStream >> cacheVersion;
+    if(cacheVersion != IMAGE_DIGEST_CACHE_VERSION)
+        return;
+
+    // Read digests, discarding all of them if the cache is damaged
+    cacheStream >> mImageDigests;
+    if(cacheStream.status() != QDataStream::Ok)
+        mImageDigests.clear();
+}
+
+void Install::saveImageDigestCache()
+{
+    // Failures are ignored, images are just hashed again next time
+    QMutexLocker digestLocker(&mImageDigestMutex);
+    QString cachePath = imageDigestCachePath();
+    if(!QDir().mkpath(QFileInfo(cachePath).absolutePath()))
+        return;
+
+    QSaveFile cacheFile(cachePath);
+    if(!cacheFile.open(QIODevice::WriteOnly))
+        return;
+
+    QDataStream cacheStream(&cacheFile);
+    cacheStream.setVersion(QDataStream::Qt_5_15);
+    cacheStream << IMAGE_DIGEST_CACHE_VERSION << mImageDigests;
+
+    if(cacheStream.status() == QDataStream::Ok)
+        cacheFile.commit();
+    else
+        cacheFile.cancelWriting();
+}
+
 Qx::IOOpReport Install::populateExistingDocs(QStringList platformMatches, QStringList playlistMatches)
 {
     // Clear existing
@@ -297,10 +680,11 @@ Qx::IOOpReport Install::populateExistingDocs(QStringList platformMatches, QStrin
 Qx::XmlStreamReaderError Install::openPlatformDoc(std::unique_ptr<Xml::PlatformDoc>& returnBuffer, QString name, UpdateOptions updateOptions)
 {
     // Create doc file reference
-    std::unique_ptr<QFile> docFile = std::make_unique<QFile>(mPlatformsDirectory.absolutePath() + '/' + makeFileNameLBKosher(name) + XML_EXT);
+    std::unique_ptr<QFile> docFile = std::make_unique<QFile>(getPlatformDocPath(name));
+    QString existingSourcePath = docFile->fileName(); // Existing entries are mapped from here
 
     // Construct unopened document
-    returnBuffer = std::make_unique<Xml::PlatformDoc>(std::move(docFile), name, updateOptions, Xml::PlatformDoc::Key{});
+    returnBuffer = std::make_unique<Xml::PlatformDoc>(std::move(docFile), name, updateOptions, existingSourcePath, Xml::PlatformDoc::Key{});
 
     // Construct doc reader
     Xml::PlatformDocReader docReader(returnBuffer.get());
@@ -322,7 +706,8 @@ Qx::XmlStreamReaderError Install::openPlaylistDoc(std::unique_ptr<Xml::PlaylistD
     std::unique_ptr<QFile> docFile = std::make_unique<QFile>(mPlaylistsDirectory.absolutePath() + '/' + makeFileNameLBKosher(name) + XML_EXT);
 
     // Construct unopened document
-    returnBuffer = std::make_unique<Xml::PlaylistDoc>(std::move(docFile), name, updateOptions, &mLBDatabaseIDTracker, Xml::PlaylistDoc::Key{});
+    returnBuffer = std::make_unique<Xml::PlaylistDoc>(std::move(docFile), name, updateOptions, &mLBDatabaseIDTracker, &mLBDatabaseIDTrackerMutex,
+                                                      Xml::PlaylistDoc::Key{});
 
     // Construct doc reader
     Xml::PlaylistDocReader docReader(returnBuffer.get());
@@ -362,11 +747,8 @@ Qx::XmlStreamReaderError Install::openPlatformsDoc(std::unique_ptr<Xml::Platform
 
 bool Install::savePlatformDoc(QString& errorMessage, std::unique_ptr<Xml::PlatformDoc> document)
 {
-    // Prepare writer
-    Xml::PlatformDocWriter docWriter(document.get());
-
-    // Write
-    bool writeErrorStatus = saveDataDocument(errorMessage, document.get(), &docWriter);
+    // Finish with the writer entries were streamed to
+    bool writeErrorStatus = saveDataDocument(errorMessage, document.get(), document->mDocWriter.get());
 
     // Ensure document is cleared
     document.reset();
@@ -405,6 +787,36 @@ bool Install::savePlatformsDoc(QString &errorMessage, std::unique_ptr<Xml::Platf
     return writeErrorStatus;
 }
 
+void Install::resetImageCopyCounts()
+{
+    mImageCloningUnsupported = false;
+    mImageHardLinkingUnsupported = false;
+    mClonedImageCount = 0;
+    mCopiedImageCount = 0;
+}
+
+void Install::scanImageSources(QList<QDir> sourceDirs)
+{
+    // Fresh scans for this import
+    QHash<QString, QHash<QUuid, ImageFileState>> scannedImages;
+    for(const QDir& sourceDir : qAsConst(sourceDirs))
+        scannedImages[sourceDir.absolutePath()] = scanImageDirectory(sourceDir, true);
+
+    QMutexLocker scanLocker(&mImageScanMutex);
+    mScannedImages = scannedImages;
+}
+
+void Install::scanPlatformImages(QString platform)
+{
+    QString platformImagesPath = mPlatformImagesDirectory.absolutePath() + '/' + platform + '/';
+    QHash<QUuid, ImageFileState> scannedLogos = scanImageDirectory(QDir(platformImagesPath + LOGO_PATH), false);
+    QHash<QUuid, ImageFileState> scannedScreenshots = scanImageDirectory(QDir(platformImagesPath + SCREENSHOT_PATH), false);
+
+    QMutexLocker scanLocker(&mImageScanMutex);
+    mScannedImages[platformImagesPath + LOGO_PATH] = scannedLogos;
+    mScannedImages[platformImagesPath + SCREENSHOT_PATH] = scannedScreenshots;
+}
+
 bool Install::ensureImageDirectories(QString& errorMessage,QString platform)
 {
     // Ensure error message is null
@@ -429,6 +841,13 @@ bool Install::ensureImageDirectories(QString& errorMessage,QString platform)
     return true;
 }
 
+bool Install::gameImagesCurrent(ImageMode imageMode, QDir logoSourceDir, QDir screenshotSourceDir, QUuid gameID, QString platform)
+{
+    // Judged from the pre-scans alone, so no file is opened
+    return scannedImageIsCurrent(imageMode, logoSourceDir, LOGO_PATH, gameID, platform) &&
+           scannedImageIsCurrent(imageMode, screenshotSourceDir, SCREENSHOT_PATH, gameID, platform);
+}
+
 bool Install::transferLogo(QString& errorMessage, ImageMode imageMode, QDir logoSourceDir, const LB::Game& game)
 {
     errorMessage = transferImage(imageMode, logoSourceDir, LOGO_PATH, game);
@@ -446,6 +865,9 @@ int Install::revertNextChange(QString& errorMessage, bool skipOnFail)
     // Ensure error message is null
     errorMessage = QString();
 
+    // Lock revert lists
+    QMutexLocker trackerLocker(&mTrackerMutex);
+
     // Get operation count for return
     int operationsLeft = mModifiedXMLDocuments.size() + mPurgableImages.size();
 
@@ -496,15 +918,28 @@ int Install::revertNextChange(QString& errorMessage, bool skipOnFail)
 
 void Install::softReset()
 {
+    QMutexLocker trackerLocker(&mTrackerMutex);
     mModifiedXMLDocuments.clear();
     mPurgableImages.clear();
     mLeasedHandles.clear();
+
+    QMutexLocker scanLocker(&mImageScanMutex);
+    mScannedImages.clear();
+
+    QMutexLocker idTrackerLocker(&mLBDatabaseIDTrackerMutex);
     mLBDatabaseIDTracker = Qx::FreeIndexTracker<int>(0, -1);
 }
 
 QString Install::getPath() const { return mRootDirectory.absolutePath(); }
+QString Install::getPlatformDocPath(QString name) const { return mPlatformsDirectory.absolutePath() + '/' + makeFileNameLBKosher(name) + XML_EXT; }
+
+int Install::getRevertQueueCount() const
+{
+    QMutexLocker trackerLocker(&mTrackerMutex);
+    return mModifiedXMLDocuments.size() + mPurgableImages.size();
+}
 
-int Install::getRevertQueueCount() const { return mModifiedXMLDocuments.size() + mPurgableImages.size(); }
+Install::ImageCopyCounts Install::getImageCopyCounts() const { return {mClonedImageCount, mCopiedImageCount}; }
 
 QSet<QString> Install::getExistingPlatforms() const { return getExistingDocs(Xml::PlatformDoc::TYPE_NAME); }
 
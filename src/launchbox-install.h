@@ -4,6 +4,9 @@
 #include <QString>
 #include <QDir>
 #include <QSet>
+#include <QMutex>
+#include <QDataStream>
+#include <atomic>
 #include <QtXml>
 #include "qx-io.h"
 #include "qx-xml.h"
@@ -16,9 +19,51 @@ class Install
 {
 //-Class Enums---------------------------------------------------------------------------------------------------
 public:
-    enum ImageMode {Copy, Reference, Link};
+    enum ImageMode {Copy, Reference, Link, HardLink};
     enum PlaylistGameMode {SelectedPlatform, ForceAll};
 
+//-Class Structs----------------------------------------------------------------------------------------------------
+public:
+    struct ImageCopyCounts
+    {
+        int cloned; // Shared the source's storage through block cloning
+        int copied; // Fully copied
+    };
+
+private:
+    struct ImageFileState
+    {
+        bool present; // File or symbolic link
+        bool symLink; // Size and modification time are of the link itself when scanned, so are re-read when needed
+        qint64 size;
+        qint64 modified;
+    };
+
+    struct ImagePaths
+    {
+        QString sourceDir;
+        QString source;
+        QString destinationDir;
+        QString destination;
+    };
+
+    struct ImageDigest
+    {
+        qint64 size; // File as it was when hashed
+        qint64 modified;
+        QByteArray digest;
+
+        friend QDataStream& operator<< (QDataStream& stream, const ImageDigest& imageDigest)
+        {
+            return stream << imageDigest.size << imageDigest.modified << imageDigest.digest;
+        }
+
+        friend QDataStream& operator>> (QDataStream& stream, ImageDigest& imageDigest)
+        {
+            return stream >> imageDigest.size >> imageDigest.modified >> imageDigest.digest;
+        }
+    };
+
 //-Class Variables--------------------------------------------------------------------------------------------------
 public:
     //
@@ -36,12 +81,18 @@ public:
     static inline const QString XML_EXT = ".xml";
     static inline const QString IMAGE_EXT = ".png";
     static inline const QString MODIFIED_FILE_EXT = ".obk";
+    static inline const QString IMAGE_DIGEST_CACHE_NAME = "launchbox-image-digests-%1.cache"; // Under the user cache location, per install
+    static inline const quint32 IMAGE_DIGEST_CACHE_VERSION = 1;
+
+    // Image copying
+    static inline const qint64 IMAGE_CLONE_CHUNK_SIZE = Q_INT64_C(1) << 30; // Block clone requests must stay under 4 GiB
 
     // Images Errors
     static inline const QString ERR_IMAGE_WONT_BACKUP = R"(Cannot rename the existing image "%1" for backup.)";
     static inline const QString ERR_IMAGE_WONT_COPY = R"(Cannot copy the image "%1" to "%2".)";
     static inline const QString ERR_IMAGE_WONT_MOVE = R"(Cannot move the image "%1" to "%2".)";
     static inline const QString ERR_IMAGE_WONT_LINK = R"(Cannot create a symbolic link from "%1" to "%2".)";
+    static inline const QString ERR_IMAGE_WONT_HARD_LINK = R"(Cannot create a hard link or copy from "%1" to "%2".)";
     static inline const QString ERR_CANT_MAKE_DIR = R"(Could not create the image directory "%1". Make sure you have write permissions at that location.)";
 
     // Reversion Errors
@@ -65,11 +116,27 @@ private:
     // XML Interaction
     QList<QString> mModifiedXMLDocuments;
     QSet<Xml::DataDocHandle> mLeasedHandles;
+    mutable QMutex mTrackerMutex; // Guards leases and revert lists when platforms are imported in parallel
 
     // Other trackers
     QList<QString> mPurgableImages;
     QMap<QString, QString> mLinksToReverse;
     Qx::FreeIndexTracker<int> mLBDatabaseIDTracker = Qx::FreeIndexTracker<int>(0, -1, {});
+    QMutex mLBDatabaseIDTrackerMutex; // Playlist docs can be read ahead on other threads
+
+    // Image up-to-date checks
+    QHash<QString, ImageDigest> mImageDigests;
+    QMutex mImageDigestMutex;
+
+    // Image pre-scan
+    QHash<QString, QHash<QUuid, ImageFileState>> mScannedImages; // By scanned directory, then by game
+    QMutex mImageScanMutex;
+
+    // Image copy strategy
+    std::atomic_bool mImageCloningUnsupported = false; // Set once the image volumes are found not to support block cloning
+    std::atomic_bool mImageHardLinkingUnsupported = false; // Set once images are found to be on different volumes
+    std::atomic_int mClonedImageCount = 0;
+    std::atomic_int mCopiedImageCount = 0;
     // TODO: Even though the playlist game IDs dont seem to matter, at some for for completeness scann all playlists when hooking an install to get the
     // full list of in use IDs
 
@@ -80,6 +147,10 @@ public:
 //-Class Functions------------------------------------------------------------------------------------------------------
 private:
     static void allowUserWriteOnXML(QString xmlPath);
+   static QString makeBackupPath(const QFileInfo& fileInfo);
+   static bool cloneImage(bool& cloningUnsupported, QString sourcePath, QString destinationPath);
+   static ImageFileState statImage(QString imagePath);
+   static QHash<QUuid, ImageFileState> scanImageDirectory(QDir imageDir, bool idSubfolders);
 
 public:
    static bool pathIsValidInstall(QString installPath);
@@ -87,6 +158,15 @@ public:
 
 //-Instance Functions------------------------------------------------------------------------------------------------------
 private:
+   QString imageDigestCachePath() const;
+   bool imageDigest(QByteArray& digestBuffer, QString imagePath, const ImageFileState& imageState);
+   bool imageIsCurrent(QString sourcePath, ImageFileState sourceState, QString destinationPath, ImageFileState destinationState);
+   ImagePaths imagePaths(QDir sourceDir, QString destinationSubPath, QUuid gameID, QString platform) const;
+   ImageFileState imageFileState(QString imageDir, QUuid gameID, QString imagePath);
+   bool scannedImageIsCurrent(ImageMode imageMode, QDir sourceDir, QString destinationSubPath, QUuid gameID, QString platform);
+   void recordTransferredImage(QString imageDir, QUuid gameID, const ImageFileState& imageState);
+   bool copyImage(QString sourcePath, QString destinationPath);
+   bool hardLinkImage(QString sourcePath, QString destinationPath);
    QString transferImage(ImageMode imageMode, QDir sourceDir, QString destinationSubPath, const LB::Game& game);
    Qx::XmlStreamReaderError openDataDocument(Xml::DataDoc* docToOpen, Xml::DataDocReader* docReader);
    bool saveDataDocument(QString& errorMessage, Xml::DataDoc* docToSave, Xml::DataDocWriter* docWriter);
@@ -102,7 +182,13 @@ public:
    bool savePlaylistDoc(QString& errorMessage, std::unique_ptr<Xml::PlaylistDoc> document);
    bool savePlatformsDoc(QString& errorMessage, std::unique_ptr<Xml::PlatformsDoc> document);
 
+   void loadImageDigestCache();
+   void saveImageDigestCache();
+   void resetImageCopyCounts();
+   void scanImageSources(QList<QDir> sourceDirs);
+   void scanPlatformImages(QString platform);
    bool ensureImageDirectories(QString& errorMessage, QString platform);
+   bool gameImagesCurrent(ImageMode imageMode, QDir logoSourceDir, QDir screenshotSourceDir, QUuid gameID, QString platform);
    bool transferLogo(QString& errorMessage, ImageMode imageMode, QDir logoSourceDir, const LB::Game& game);
    bool transferScreenshot(QString& errorMessage, ImageMode imageMode, QDir screenshotSourceDir, const LB::Game& game);
 
@@ -110,7 +196,9 @@ public:
    void softReset();
 
    QString getPath() const;
+   QString getPlatformDocPath(QString name) const;
    int getRevertQueueCount() const;
+   ImageCopyCounts getImageCopyCounts() const;
    QSet<QString> getExistingPlatforms() const;
    QSet<QString> getExistingPlaylists() const;
 
@@ -0,0 +1,261 @@
+#include "launchbox-xml-text.h"
+#include <QtAlgorithms>
+#include <private/qsimd_p.h>
+#include <cstring>
+
+#if defined(Q_PROCESSOR_X86)
+#include <immintrin.h>
+#endif
+
+namespace LB
+{
+
+//===============================================================================================================
+// XML TEXT
+//===============================================================================================================
+
+//-Class Functions------------------------------------------------------------------------------------------------
+//Private:
+const char* XmlText::findAny(const char* pos, const char* end, const char (&needles)[NEEDLE_COUNT], bool invalid)
+{
+    // Clean runs are skipped as wide as the CPU allows, the first match within a block is taken from its hit mask
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if(end - pos >= 32 && qCpuHasFeature(AVX2))
+        pos = findAnyAvx2(pos, end, needles, invalid); // Stops at the first match or the tail, which the narrower loops finish
+#endif
+
+#if defined(__SSE2__)
+    const __m128i needle0 = _mm_set1_epi8(needles[0]);
+    const __m128i needle1 = _mm_set1_epi8(needles[1]);
+    const __m128i needle2 = _mm_set1_epi8(needles[2]);
+    const __m128i needle3 = _mm_set1_epi8(needles[3]);
+    const __m128i controlMax = _mm_set1_epi8(0x1F);
+    const __m128i nonCharLead = _mm_set1_epi8(char(0xEF));
+
+    while(end - pos >= 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, needle0), _mm_cmpeq_epi8(block, needle1)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(block, needle2), _mm_cmpeq_epi8(block, needle3)));
+        if(invalid)
+        {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(_mm_min_epu8(block, controlMax), block)); // Bytes <= 0x1F
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, nonCharLead));
+        }
+
+        uint hitMask = uint(_mm_movemask_epi8(hits));
+        if(hitMask)
+            return pos + qCountTrailingZeroBits(hitMask);
+
+        pos += 16;
+    }
+#endif
+
+    // Scalar fallback, a word at a time
+    static const quint64 ONES = Q_UINT64_C(0x0101010101010101);
+    static const quint64 HIGHS = Q_UINT64_C(0x8080808080808080);
+    auto hasZeroByte = [](quint64 word){ return (word - ONES) & ~word & HIGHS; };
+
+    while(pos < end)
+    {
+        if(end - pos >= 8)
+        {
+            quint64 word;
+            std::memcpy(&word, pos, 8);
+
+            quint64 hit = hasZeroByte(word ^ (ONES * uchar(needles[0]))) | hasZeroByte(word ^ (ONES * uchar(needles[1]))) |
+                          hasZeroByte(word ^ (ONES * uchar(needles[2]))) | hasZeroByte(word ^ (ONES * uchar(needles[3])));
+            if(invalid)
+                hit |= ((word - ONES * 0x20) & ~word & HIGHS) | hasZeroByte(word ^ (ONES * 0xEF)); // Any byte below 0x20 or 0xEF
+
+            if(!hit)
+            {
+                pos += 8;
+                continue;
+            }
+        }
+
+        // Locate within the word
+        for(const char* wordEnd = pos + qMin<qptrdiff>(8, end - pos); pos < wordEnd; pos++)
+        {
+            if(*pos == needles[0] || *pos == needles[1] || *pos == needles[2] || *pos == needles[3] ||
+               (invalid && (uchar(*pos) < 0x20 || uchar(*pos) == 0xEF)))
+                return pos;
+        }
+    }
+
+    return end;
+}
+
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+QT_FUNCTION_TARGET(AVX2)
+const char* XmlText::findAnyAvx2(const char* pos, const char* end, const char (&needles)[NEEDLE_COUNT], bool invalid)
+{
+    const __m256i needle0 = _mm256_set1_epi8(needles[0]);
+    const __m256i needle1 = _mm256_set1_epi8(needles[1]);
+    const __m256i needle2 = _mm256_set1_epi8(needles[2]);
+    const __m256i needle3 = _mm256_set1_epi8(needles[3]);
+    const __m256i controlMax = _mm256_set1_epi8(0x1F);
+    const __m256i nonCharLead = _mm256_set1_epi8(char(0xEF));
+
+    while(end - pos >= 32)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos));
+        __m256i hits = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, needle0), _mm256_cmpeq_epi8(block, needle1)),
+                                       _mm256_or_si256(_mm256_cmpeq_epi8(block, needle2), _mm256_cmpeq_epi8(block, needle3)));
+        if(invalid)
+        {
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(_mm256_min_epu8(block, controlMax), block)); // Bytes <= 0x1F
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, nonCharLead));
+        }
+
+        uint hitMask = uint(_mm256_movemask_epi8(hits));
+        if(hitMask)
+            return pos + qCountTrailingZeroBits(hitMask);
+
+        pos += 32;
+    }
+
+    return pos;
+}
+#endif
+
+bool XmlText::decodeReference(QByteArray& utf8Buffer, const char*& pos, const char* end)
+{
+    // Find terminator of reference starting at pos ('&')
+    const char* nameStart = pos + 1;
+    const char* semicolon = static_cast<const char*>(std::memchr(nameStart, ';', qMin<qptrdiff>(end - nameStart, 12)));
+    if(!semicolon)
+        return false;
+
+    QLatin1String name(nameStart, int(semicolon - nameStart));
+    pos = semicolon + 1;
+
+    // Predefined entities
+    if(name == QLatin1String("lt"))
+        utf8Buffer.append('<');
+    else if(name == QLatin1String("gt"))
+        utf8Buffer.append('>');
+    else if(name == QLatin1String("amp"))
+        utf8Buffer.append('&');
+    else if(name == QLatin1String("quot"))
+        utf8Buffer.append('"');
+    else if(name == QLatin1String("apos"))
+        utf8Buffer.append('\'');
+    else if(name.size() > 1 && name.at(0) == QLatin1Char('#'))
+    {
+        // Character reference
+        bool validNumber;
+        uint codePoint = name.at(1) == QLatin1Char('x') ? QString(name.mid(2)).toUInt(&validNumber, 16) :
+                                                          QString(name.mid(1)).toUInt(&validNumber, 10);
+
+        if(!validNumber || codePoint == 0 || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+            return false;
+
+        utf8Buffer.append(QString::fromUcs4(&codePoint, 1).toUtf8());
+    }
+    else
+        return false; // Not defined by the LaunchBox docs
+
+    return true;
+}
+
+//Public:
+void XmlText::appendEscaped(QByteArray& utf8Buffer, const char* pos, const char* end)
+{
+    static const char ESCAPABLE[NEEDLE_COUNT] = {'<', '>', '&', '"'};
+
+    while(pos < end)
+    {
+        // Copy clean run in bulk
+        const char* escapable = findAny(pos, end, ESCAPABLE, true);
+        utf8Buffer.append(pos, int(escapable - pos));
+        if(escapable == end)
+            break;
+
+        // Escape as QXmlStreamWriter does for character data
+        switch(*escapable)
+        {
+            case '<':
+                utf8Buffer.append("&lt;", 4);
+                break;
+            case '>':
+                utf8Buffer.append("&gt;", 4);
+                break;
+            case '&':
+                utf8Buffer.append("&amp;", 5);
+                break;
+            case '"':
+                utf8Buffer.append("&quot;", 6);
+                break;
+            case '\t':
+            case '\n':
+            case '\r':
+                utf8Buffer.append(*escapable);
+                break;
+            case '\xEF': // Lead byte of U+FFFE and U+FFFF, which QXmlStreamWriter drops as well
+                if(end - escapable >= 3 && escapable[1] == '\xBF' && (escapable[2] == '\xBE' || escapable[2] == '\xBF'))
+                    escapable += 2;
+                else
+                    utf8Buffer.append(*escapable);
+                break;
+            default:
+                break; // Other control characters aren't valid XML
+        }
+
+        pos = escapable + 1;
+    }
+}
+
+bool XmlText::unescape(QString& textBuffer, const QByteArray& rawContent)
+{
+    // Markup within the content (CDATA, comments) is left to the stream reader
+    static const char DECODABLE[NEEDLE_COUNT] = {'&', '\r', '<', '&'};
+
+    const char* pos = rawContent.constData();
+    const char* end = pos + rawContent.size();
+    const char* decodable = findAny(pos, end, DECODABLE, false);
+
+    // Nothing to decode in most content
+    if(decodable == end)
+    {
+        textBuffer = QString::fromUtf8(rawContent);
+        return true;
+    }
+
+    QByteArray utf8;
+    utf8.reserve(rawContent.size());
+
+    while(true)
+    {
+        // Copy clean run in bulk
+        utf8.append(pos, int(decodable - pos));
+        if(decodable == end)
+            break;
+
+        pos = decodable;
+        switch(*pos)
+        {
+            case '<':
+                return false;
+
+            case '\r': // Line ends are normalized to '\n'
+                utf8.append('\n');
+                if(++pos < end && *pos == '\n')
+                    pos++;
+                break;
+
+            case '&':
+                if(!decodeReference(utf8, pos, end))
+                    return false;
+                break;
+        }
+
+        decodable = findAny(pos, end, DECODABLE, false);
+    }
+
+    textBuffer = QString::fromUtf8(utf8);
+    return true;
+}
+
+}
@@ -0,0 +1,29 @@
+#ifndef LAUNCHBOX_XML_TEXT_H
+#define LAUNCHBOX_XML_TEXT_H
+
+#include <QString>
+#include <QByteArray>
+
+namespace LB
+{
+
+class XmlText
+{
+//-Class Variables-----------------------------------------------------------------------------------------------
+private:
+    static inline const int NEEDLE_COUNT = 4;
+
+//-Class Functions----------------------------------------------------------------------------------------------
+private:
+    static const char* findAny(const char* pos, const char* end, const char (&needles)[NEEDLE_COUNT], bool invalid);
+    static const char* findAnyAvx2(const char* pos, const char* end, const char (&needles)[NEEDLE_COUNT], bool invalid); // Only built when the compiler can target AVX2
+    static bool decodeReference(QByteArray& utf8Buffer, const char*& pos, const char* end);
+
+public:
+    static void appendEscaped(QByteArray& utf8Buffer, const char* pos, const char* end);
+    static bool unescape(QString& textBuffer, const QByteArray& rawContent);
+};
+
+}
+
+#endif // LAUNCHBOX_XML_TEXT_H
@@ -1,4 +1,8 @@
 #include "launchbox-xml.h"
+#include <QFileInfo>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
 
 namespace LB
 {
@@ -24,6 +28,197 @@ uint qHash(const Xml::DataDocHandle& key, uint seed) noexcept
     return seed;
 }
 
+//===============================================================================================================
+// Xml::RawElementScanner
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+//Public:
+Xml::RawElementScanner::RawElementScanner(const QByteArray& source, int parentStart) :
+    mSource(source),
+    mCursor(parentStart < 0 ? 0 : source.size())
+{
+    // Start after the parent's start tag, or at the beginning of a sequence of elements if there is no parent
+    if(parentStart >= 0 && parentStart < mSource.size())
+    {
+        int parentTagEnd = tagEnd(parentStart);
+        if(parentTagEnd != -1)
+            mCursor = parentTagEnd;
+    }
+}
+
+//-Class Functions----------------------------------------------------------------------------------------------------
+//Public:
+int Xml::RawElementScanner::firstElement(const QByteArray& source)
+{
+    // Skip declaration, comments and doctype
+    RawElementScanner scanner(source, -1);
+    for(int pos = source.indexOf('<'); pos != -1 && pos + 1 < source.size(); pos = source.indexOf('<', pos))
+    {
+        char next = source.at(pos + 1);
+        if(next != '!' && next != '?' && next != '/')
+            return pos;
+
+        if((pos = scanner.markupEnd(pos)) == -1)
+            break;
+    }
+
+    return -1;
+}
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+//Private:
+int Xml::RawElementScanner::tagEnd(int tagStart) const
+{
+    // Find closing '>', ignoring any inside attribute values
+    char quote = '\0';
+    for(int pos = tagStart + 1; pos < mSource.size(); pos++)
+    {
+        char c = mSource.at(pos);
+        if(quote)
+        {
+            if(c == quote)
+                quote = '\0';
+        }
+        else if(c == '"' || c == '\'')
+            quote = c;
+        else if(c == '>')
+            return pos + 1;
+    }
+
+    return -1;
+}
+
+int Xml::RawElementScanner::markupEnd(int markupStart) const
+{
+    // Comments, CDATA and processing instructions can contain '<' and '>', so skip to their terminator
+    const char* markup = mSource.constData() + markupStart;
+    int available = mSource.size() - markupStart;
+    int end;
+
+    if(available >= 4 && std::memcmp(markup, "<!--", 4) == 0)
+        return (end = mSource.indexOf("-->", markupStart + 4)) != -1 ? end + 3 : -1;
+    else if(available >= 9 && std::memcmp(markup, "<![CDATA[", 9) == 0)
+        return (end = mSource.indexOf("]]>", markupStart + 9)) != -1 ? end + 3 : -1;
+    else if(available >= 2 && markup[1] == '?')
+        return (end = mSource.indexOf("?>", markupStart + 2)) != -1 ? end + 2 : -1;
+    else
+        return tagEnd(markupStart);
+}
+
+//Public:
+bool Xml::RawElementScanner::nextElement(ElementRange& rangeBuffer)
+{
+    // Find next child start tag, stopping at the parent's end tag
+    int pos = mCursor;
+    while(true)
+    {
+        pos = mSource.indexOf('<', pos);
+        if(pos == -1 || pos + 1 >= mSource.size())
+            return false;
+
+        char next = mSource.at(pos + 1);
+        if(next == '/')
+        {
+            rangeBuffer = {mCursor, pos, pos}; // Leaves just the whitespace before the parent's end tag
+            return false;
+        }
+        else if(next == '!' || next == '?')
+        {
+            if((pos = markupEnd(pos)) == -1)
+                return false;
+        }
+        else
+            break;
+    }
+
+    // Follow nesting to the child's end
+    int elementStart = pos;
+    int depth = 0;
+    do
+    {
+        if(pos + 1 >= mSource.size())
+            return false;
+
+        char next = mSource.at(pos + 1);
+        if(next == '!' || next == '?')
+            pos = markupEnd(pos);
+        else if(next == '/')
+        {
+            pos = tagEnd(pos);
+            depth--;
+        }
+        else
+        {
+            pos = tagEnd(pos);
+            if(pos != -1 && mSource.at(pos - 2) != '/')
+                depth++;
+        }
+
+        if(pos == -1 || (depth > 0 && (pos = mSource.indexOf('<', pos)) == -1))
+            return false;
+    }
+    while(depth > 0);
+
+    rangeBuffer = {mCursor, elementStart, pos};
+    mCursor = pos;
+    return true;
+}
+
+QByteArray Xml::RawElementScanner::rawBytes(const ElementRange& range) const
+{
+    // Leave out whitespace before the element, writers indent in their own style
+    int rawStart = range.leadingStart;
+    while(rawStart < range.start && std::isspace(uchar(mSource.at(rawStart))))
+        rawStart++;
+
+    return QByteArray::fromRawData(mSource.constData() + rawStart, range.end - rawStart);
+}
+
+QByteArray Xml::RawElementScanner::rawContent(const ElementRange& range) const
+{
+    // Empty element has no content
+    int contentStart = tagEnd(range.start);
+    if(contentStart == -1 || contentStart >= range.end || mSource.at(contentStart - 2) == '/')
+        return QByteArray();
+
+    int contentEnd = mSource.lastIndexOf("</", range.end - 1);
+    return QByteArray::fromRawData(mSource.constData() + contentStart, qMax(contentEnd - contentStart, 0));
+}
+
+//===============================================================================================================
+// Xml::DigestDevice
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+//Public:
+Xml::DigestDevice::DigestDevice(QIODevice* target) : mTarget(target), mHash(ALGORITHM) {}
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+//Protected:
+qint64 Xml::DigestDevice::readData(char* data, qint64 maxSize)
+{
+    Q_UNUSED(data);
+    Q_UNUSED(maxSize);
+    return -1;
+}
+
+qint64 Xml::DigestDevice::writeData(const char* data, qint64 maxSize)
+{
+    qint64 written = mTarget->write(data, maxSize);
+
+    if(written > 0)
+        mHash.addData(data, int(written));
+    else if(written < 0)
+        setErrorString(mTarget->errorString());
+
+    return written;
+}
+
+//Public:
+bool Xml::DigestDevice::isSequential() const { return true; }
+QByteArray Xml::DigestDevice::digest() const { return mHash.result(); }
+
 //===============================================================================================================
 // Xml::DataDoc
 //===============================================================================================================
@@ -31,12 +226,15 @@ uint qHash(const Xml::DataDocHandle& key, uint seed) noexcept
 //-Constructor--------------------------------------------------------------------------------------------------------
 //Public:
 Xml::DataDoc::DataDoc(std::unique_ptr<QFile> xmlFile, DataDocHandle handle)
-    : mDocumentFile(std::move(xmlFile)), mHandleTarget(handle) {}
+    : mDocumentFile(std::move(xmlFile)), mDocumentSaveFile(mDocumentFile->fileName()), mDocumentWriteDevice(&mDocumentSaveFile), mHandleTarget(handle)
+{
+    // Never fall back to writing the document in place
+    mDocumentSaveFile.setDirectWriteFallback(false);
+}
 
 //-Instance Functions--------------------------------------------------------------------------------------------------
 //Public:
 Xml::DataDocHandle Xml::DataDoc::getHandleTarget() const { return mHandleTarget; }
-void Xml::DataDoc::clearFile() { mDocumentFile->resize(0); }
 
 //===============================================================================================================
 // Xml::DataDocReader
@@ -44,12 +242,21 @@ void Xml::DataDoc::clearFile() { mDocumentFile->resize(0); }
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 //Public:
-Xml::DataDocReader::DataDocReader(Xml::DataDoc* targetDoc) : mTargetDocument(targetDoc) {}
+Xml::DataDocReader::DataDocReader(Xml::DataDoc* targetDoc, bool loadSource) : mTargetDocument(targetDoc), mLoadSource(loadSource) {}
 
 Qx::XmlStreamReaderError Xml::DataDocReader::readInto()
 {
-    // Hook reader to document handle
-    mStreamReader.setDevice(mTargetDocument->mDocumentFile.get());
+    // Hook reader to document handle, or a copy of its contents if required
+    if(mLoadSource)
+    {
+        mSource = mTargetDocument->mDocumentFile->readAll();
+        mTargetDocument->mExistingDigest = QCryptographicHash::hash(mSource, DigestDevice::ALGORITHM);
+        mSourceBuffer.setData(mSource);
+        mSourceBuffer.open(QIODevice::ReadOnly);
+        mStreamReader.setDevice(&mSourceBuffer);
+    }
+    else
+        mStreamReader.setDevice(mTargetDocument->mDocumentFile.get());
 
     // Prepare error return instance
     Qx::XmlStreamReaderError readError;
@@ -78,6 +285,179 @@ Qx::XmlStreamReaderError Xml::DataDocReader::readInto()
     return readError;
 }
 
+//===============================================================================================================
+// Xml::BufferedStreamWriter
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------------
+//Public:
+Xml::BufferedStreamWriter::BufferedStreamWriter() :
+    mDevice(nullptr),
+    mHasError(false),
+    mInStartElement(false),
+    mInEmptyElement(false),
+    mWroteSomething(false),
+    mLastWasStartElement(false)
+{
+    mBuffer.reserve(BUFFER_SIZE + BUFFER_SIZE / 4);
+}
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+//Private:
+void Xml::BufferedStreamWriter::append(const char* data, int size)
+{
+    mBuffer.append(data, size);
+    if(mBuffer.size() >= BUFFER_SIZE)
+        flush();
+}
+
+void Xml::BufferedStreamWriter::append(const QByteArray& data) { append(data.constData(), data.size()); }
+
+void Xml::BufferedStreamWriter::appendIndent(int level)
+{
+    while(mIndents.size() <= level)
+        mIndents.append('\n' + QByteArray(mIndents.size() * INDENT_WIDTH, ' '));
+
+    append(mIndents.at(level));
+}
+
+void Xml::BufferedStreamWriter::appendEscaped(const QString& text)
+{
+    QByteArray utf8 = text.toUtf8();
+    XmlText::appendEscaped(mBuffer, utf8.constData(), utf8.constData() + utf8.size());
+    if(mBuffer.size() >= BUFFER_SIZE)
+        flush();
+}
+
+int Xml::BufferedStreamWriter::tagIndex(const QString& name)
+{
+    QHash<QString, int>::const_iterator existing = mTagIndices.constFind(name);
+    if(existing != mTagIndices.constEnd())
+        return existing.value();
+
+    // Encode new tag
+    QByteArray utf8Name = name.toUtf8();
+    mTags.append(Tag{'<' + utf8Name, "</" + utf8Name + '>'});
+    mTagIndices.insert(name, mTags.size() - 1);
+    return mTags.size() - 1;
+}
+
+bool Xml::BufferedStreamWriter::finishStartElement(bool contents)
+{
+    bool hadSomethingWritten = mWroteSomething;
+    mWroteSomething = contents;
+
+    if(!mInStartElement)
+        return hadSomethingWritten;
+
+    // Close pending start tag
+    if(mInEmptyElement)
+    {
+        append("/>", 2);
+        mTagStack.removeLast();
+        mLastWasStartElement = false;
+    }
+    else
+        append(">", 1);
+
+    mInStartElement = mInEmptyElement = false;
+    return hadSomethingWritten;
+}
+
+//Public:
+void Xml::BufferedStreamWriter::setDevice(QIODevice* device) { mDevice = device; }
+QIODevice* Xml::BufferedStreamWriter::device() const { return mDevice; }
+bool Xml::BufferedStreamWriter::hasError() const { return mHasError; }
+
+void Xml::BufferedStreamWriter::writeStartDocument()
+{
+    finishStartElement(false);
+    append(DOCUMENT_START);
+}
+
+void Xml::BufferedStreamWriter::writeEndDocument()
+{
+    while(!mTagStack.isEmpty())
+        writeEndElement();
+    append("\n", 1);
+    flush();
+}
+
+void Xml::BufferedStreamWriter::writeStartElement(const QString& name)
+{
+    if(!finishStartElement(false))
+        appendIndent(mTagStack.size());
+
+    int tag = tagIndex(name);
+    append(mTags.at(tag).start);
+    mTagStack.append(tag);
+    mInStartElement = mLastWasStartElement = true;
+}
+
+void Xml::BufferedStreamWriter::writeEndElement()
+{
+    if(mTagStack.isEmpty())
+        return;
+
+    // Close as empty tag if nothing was written
+    if(mInStartElement && !mInEmptyElement)
+    {
+        append("/>", 2);
+        mLastWasStartElement = mInStartElement = false;
+        mTagStack.removeLast();
+        return;
+    }
+
+    if(!finishStartElement(false) && !mLastWasStartElement)
+        appendIndent(mTagStack.size() - 1);
+    if(mTagStack.isEmpty())
+        return;
+
+    mLastWasStartElement = false;
+    append(mTags.at(mTagStack.takeLast()).end);
+}
+
+void Xml::BufferedStreamWriter::writeEmptyElement(const QString& name)
+{
+    writeStartElement(name);
+    mInEmptyElement = true;
+}
+
+void Xml::BufferedStreamWriter::writeTextElement(const QString& name, const QString& text)
+{
+    writeStartElement(name);
+    writeCharacters(text);
+    writeEndElement();
+}
+
+void Xml::BufferedStreamWriter::writeCharacters(const QString& text)
+{
+    finishStartElement();
+    appendEscaped(text);
+}
+
+void Xml::BufferedStreamWriter::writeRawElement(const QByteArray& element)
+{
+    // Placed like a child written through writeStartElement()/writeEndElement()
+    if(!finishStartElement(false))
+        appendIndent(mTagStack.size());
+
+    append(element);
+    mLastWasStartElement = false;
+}
+
+bool Xml::BufferedStreamWriter::flush()
+{
+    if(mBuffer.isEmpty() || mHasError)
+        return !mHasError;
+
+    if(!mDevice || mDevice->write(mBuffer) != mBuffer.size())
+        mHasError = true;
+
+    mBuffer.resize(0); // Keeps capacity
+    return !mHasError;
+}
+
 //===============================================================================================================
 // Xml::DataDocWriter
 //===============================================================================================================
@@ -89,20 +469,26 @@ Xml::DataDocWriter::DataDocWriter(DataDoc* sourceDoc)
 
 //-Instance Functions-------------------------------------------------------------------------------------------------
 //Public:
-QString Xml::DataDocWriter::writeOutOf()
+void Xml::DataDocWriter::beginDocument()
 {
-    // Hook writer to document handle
-    mStreamWriter.setDevice(mSourceDocument->mDocumentFile.get());
+    // Skip if already started
+    if(mStreamWriter.device())
+        return;
 
-    // Enable auto formating
-    mStreamWriter.setAutoFormatting(true);
-    mStreamWriter.setAutoFormattingIndent(2);
+    // Hook writer to document handle
+    mStreamWriter.setDevice(&mSourceDocument->mDocumentWriteDevice);
 
     // Write standard XML header
-    mStreamWriter.writeStartDocument("1.0", true);
+    mStreamWriter.writeStartDocument();
 
     // Write main LaunchBox tag
     mStreamWriter.writeStartElement(XML_ROOT_ELEMENT);
+}
+
+QString Xml::DataDocWriter::writeOutOf()
+{
+    // Start document if entries weren't already written
+    beginDocument();
 
     // Write main body
     if(!writeSourceDoc())
@@ -111,8 +497,10 @@ QString Xml::DataDocWriter::writeOutOf()
     // Close main LaunchBox tag
     mStreamWriter.writeEndElement();
 
-    // Finish document
+    // Finish document, flushing remaining output
     mStreamWriter.writeEndDocument();
+    if(mStreamWriter.hasError())
+        return mStreamWriter.device()->errorString();
 
     // Return null string on success
     return QString();
@@ -126,10 +514,13 @@ void Xml::DataDocWriter::writeEmptyCheckedTextElement(const QString& qualifiedNa
         mStreamWriter.writeTextElement(qualifiedName, text);
 }
 
-void Xml::DataDocWriter::writeOtherFields(const QHash<QString, QString>& otherFields)
+void Xml::DataDocWriter::writeOtherFields(const QByteArray& otherFields)
 {
-    for(QHash<QString, QString>::const_iterator i = otherFields.constBegin(); i != otherFields.constEnd(); ++i)
-        writeEmptyCheckedTextElement(i.key(), i.value());
+    // Pass each element through verbatim, but on its own line at the writer's indent
+    RawElementScanner fieldScanner(otherFields, -1);
+    RawElementScanner::ElementRange fieldRange;
+    while(fieldScanner.nextElement(fieldRange))
+        mStreamWriter.writeRawElement(fieldScanner.rawBytes(fieldRange));
 }
 
 //===============================================================================================================
@@ -147,79 +538,207 @@ Xml::ConfigDoc::ConfigDoc(std::unique_ptr<QFile> xmlFile, DataDocHandle handle)
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 //Public:
-Xml::PlatformDoc::PlatformDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, const Key&)
-    : DataDoc(std::move(xmlFile), DataDocHandle{TYPE_NAME, docName}), mUpdateOptions(updateOptions) {}
+Xml::PlatformDoc::PlatformDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, QString existingSourcePath, const Key&)
+    : DataDoc(std::move(xmlFile), DataDocHandle{TYPE_NAME, docName}), mUpdateOptions(updateOptions), mDocWriter(std::make_unique<PlatformDocWriter>(this)),
+      mGamesFinished(false), mExistingSourceFile(existingSourcePath), mExistingSource(nullptr) {}
 
 //-Instance Functions--------------------------------------------------------------------------------------------------
+//Private:
+Qx::XmlStreamReaderError Xml::PlatformDoc::readExistingGame(Game& gameBuffer, EntryRange range) const
+{
+    // Entries were validated when indexed, so this only fails if the index is off
+    QByteArray entrySource = QByteArray::fromRawData(mExistingSource + range.offset, range.length);
+    QXmlStreamReader entryReader(entrySource);
+    if(!entryReader.readNextStartElement() || entryReader.name() != Element_Game::NAME)
+        return Qx::XmlStreamReaderError(formatDataDocError(ERR_ENTRY_UNREADABLE, mHandleTarget));
+
+    RawElementScanner fieldScanner(entrySource, 0);
+    gameBuffer = PlatformDocReader::parseGame(entryReader, fieldScanner);
+    return entryReader.hasError() ? Qx::XmlStreamReaderError(entryReader.error()) : Qx::XmlStreamReaderError();
+}
+
+Qx::XmlStreamReaderError Xml::PlatformDoc::readExistingAddApp(AddApp& addAppBuffer, EntryRange range) const
+{
+    QByteArray entrySource = QByteArray::fromRawData(mExistingSource + range.offset, range.length);
+    QXmlStreamReader entryReader(entrySource);
+    if(!entryReader.readNextStartElement() || entryReader.name() != Element_AddApp::NAME)
+        return Qx::XmlStreamReaderError(formatDataDocError(ERR_ENTRY_UNREADABLE, mHandleTarget));
+
+    RawElementScanner fieldScanner(entrySource, 0);
+    addAppBuffer = PlatformDocReader::parseAddApp(entryReader, fieldScanner);
+    return entryReader.hasError() ? Qx::XmlStreamReaderError(entryReader.error()) : Qx::XmlStreamReaderError();
+}
+
+void Xml::PlatformDoc::writeGame(const Game& game)
+{
+    // Write errors persist in the writer and are reported when the document is saved
+    mDocWriter->beginDocument();
+    mDocWriter->writeGame(game);
+    mFinalGameDetails[game.getID()] = {game.getTitle(), QFileInfo(game.getAppPath()).fileName(), game.getPlatform()};
+}
+
+void Xml::PlatformDoc::writeAddApp(const AddApp& app)
+{
+    mDocWriter->beginDocument();
+    mDocWriter->writeAddApp(app);
+    mFinalAddAppIDs.insert(app.getID());
+}
+
+Qx::XmlStreamReaderError Xml::PlatformDoc::finishGames()
+{
+    mGamesFinished = true;
+
+    // Write remaining existing games if obsolete entries are to be kept, in their original order so repeat imports give identical docs
+    if(!mUpdateOptions.removeObsolete)
+    {
+        QList<EntryRange> gameRanges = mGamesExisting.values();
+        std::sort(gameRanges.begin(), gameRanges.end(), [](const EntryRange& lhs, const EntryRange& rhs){ return lhs.offset < rhs.offset; });
+
+        for(const EntryRange& range : qAsConst(gameRanges))
+        {
+            Game existingGame;
+            Qx::XmlStreamReaderError readError = readExistingGame(existingGame, range);
+            if(readError.isValid())
+                return readError;
+
+            writeGame(existingGame);
+        }
+    }
+
+    mGamesExisting.clear();
+    return Qx::XmlStreamReaderError();
+}
+
 //Public:
-const QHash<QUuid, Game>& Xml::PlatformDoc::getFinalGames() const { return mGamesFinal; }
-const QHash<QUuid, AddApp>& Xml::PlatformDoc::getFinalAddApps() const { return mAddAppsFinal; }
+const QHash<QUuid, PlaylistGame::EntryDetails>& Xml::PlatformDoc::getFinalGameDetails() const { return mFinalGameDetails; }
 
-bool Xml::PlatformDoc::containsGame(QUuid gameID) const { return mGamesFinal.contains(gameID) || mGamesExisting.contains(gameID); }
-bool Xml::PlatformDoc::containsAddApp(QUuid addAppId) const { return mAddAppsFinal.contains(addAppId) || mAddAppsExisting.contains(addAppId); }
+bool Xml::PlatformDoc::containsGame(QUuid gameID) const { return mFinalGameDetails.contains(gameID) || mGamesExisting.contains(gameID); }
+bool Xml::PlatformDoc::containsAddApp(QUuid addAppId) const { return mFinalAddAppIDs.contains(addAppId) || mAddAppsExisting.contains(addAppId); }
 
-void Xml::PlatformDoc::addGame(Game game)
+Qx::XmlStreamReaderError Xml::PlatformDoc::addGame(Game game, bool existingIsCurrent)
 {
     QUuid key = game.getID();
 
     // Check if game exists
     if(mGamesExisting.contains(key))
     {
-        // Replace if existing update is on, move existing otherwise
+        // Copy the existing entry straight from the source if it would be written back unchanged
+        if(existingIsCurrent)
+            return keepExistingGame(key, {game.getTitle(), QFileInfo(game.getAppPath()).fileName(), game.getPlatform()});
+
+        Game existingGame;
+        Qx::XmlStreamReaderError readError = readExistingGame(existingGame, mGamesExisting.take(key));
+        if(readError.isValid())
+            return readError;
+
+        // Replace if existing update is on, keep existing otherwise
         if(mUpdateOptions.importMode == ImportMode::NewAndExisting)
-        {
-            game.transferOtherFields(mGamesExisting[key].getOtherFields());
-            mGamesFinal[key] = game;
-            mGamesExisting.remove(key);
-        }
+            game.transferOtherFields(existingGame.getOtherFields());
         else
-        {
-            mGamesFinal[key] = std::move(mGamesExisting[key]);
-            mGamesExisting.remove(key);
-        }
-
+            game = std::move(existingGame);
     }
-    else
-        mGamesFinal[key] = game;
+
+    writeGame(game);
+    return Qx::XmlStreamReaderError();
 }
 
-void Xml::PlatformDoc::addAddApp(AddApp app)
+Qx::XmlStreamReaderError Xml::PlatformDoc::addAddApp(AddApp app, bool existingIsCurrent)
 {
+    // Games are done once additional apps start
+    if(!mGamesFinished)
+    {
+        Qx::XmlStreamReaderError finishError = finishGames();
+        if(finishError.isValid())
+            return finishError;
+    }
+
     QUuid key = app.getID();
 
     // Check if add app exists
     if(mAddAppsExisting.contains(key))
     {
-        // Replace if existing update is on, move existing otherwise
+        // Copy the existing entry straight from the source if it would be written back unchanged
+        if(existingIsCurrent)
+            return keepExistingAddApp(key);
+
+        AddApp existingAddApp;
+        Qx::XmlStreamReaderError readError = readExistingAddApp(existingAddApp, mAddAppsExisting.take(key));
+        if(readError.isValid())
+            return readError;
+
+        // Replace if existing update is on, keep existing otherwise
         if(mUpdateOptions.importMode == ImportMode::NewAndExisting)
-        {
-            app.transferOtherFields(mAddAppsExisting[key].getOtherFields());
-            mAddAppsFinal[key] = app;
-            mAddAppsExisting.remove(key);
-        }
+            app.transferOtherFields(existingAddApp.getOtherFields());
         else
-        {
-            mAddAppsFinal[key] = std::move(mAddAppsExisting[key]);
-            mAddAppsExisting.remove(key);
-        }
+            app = std::move(existingAddApp);
+    }
+
+    writeAddApp(app);
+    return Qx::XmlStreamReaderError();
+}
 
+Qx::XmlStreamReaderError Xml::PlatformDoc::keepExistingGame(QUuid gameID, const PlaylistGame::EntryDetails& details)
+{
+    if(!mGamesExisting.contains(gameID))
+        return Qx::XmlStreamReaderError(formatDataDocError(ERR_ENTRY_MISSING, mHandleTarget));
+
+    EntryRange range = mGamesExisting.take(gameID);
+    mDocWriter->beginDocument();
+    mDocWriter->writeExistingEntry(QByteArray::fromRawData(mExistingSource + range.offset, range.length));
+    mFinalGameDetails[gameID] = details;
+    return Qx::XmlStreamReaderError();
+}
+
+Qx::XmlStreamReaderError Xml::PlatformDoc::keepExistingAddApp(QUuid addAppID)
+{
+    // Games are done once additional apps start
+    if(!mGamesFinished)
+    {
+        Qx::XmlStreamReaderError finishError = finishGames();
+        if(finishError.isValid())
+            return finishError;
     }
-    else
-        mAddAppsFinal[key] = app;
+
+    if(!mAddAppsExisting.contains(addAppID))
+        return Qx::XmlStreamReaderError(formatDataDocError(ERR_ENTRY_MISSING, mHandleTarget));
+
+    EntryRange range = mAddAppsExisting.take(addAppID);
+    mDocWriter->beginDocument();
+    mDocWriter->writeExistingEntry(QByteArray::fromRawData(mExistingSource + range.offset, range.length));
+    mFinalAddAppIDs.insert(addAppID);
+    return Qx::XmlStreamReaderError();
 }
 
-void Xml::PlatformDoc::finalize()
+Qx::XmlStreamReaderError Xml::PlatformDoc::finalize()
 {
-    // Copy items to final list if obsolete entries are to be kept
-    if(!mUpdateOptions.removeObsolete)
+    // Write remaining existing games if there were no additional apps to trigger it
+    Qx::XmlStreamReaderError finalizeError;
+    if(!mGamesFinished)
+        finalizeError = finishGames();
+
+    // Write remaining existing additional apps if obsolete entries are to be kept, ordered like the games
+    if(!finalizeError.isValid() && !mUpdateOptions.removeObsolete)
     {
-        mGamesFinal.insert(mGamesExisting);
-        mAddAppsFinal.insert(mAddAppsExisting);
+        QList<EntryRange> addAppRanges = mAddAppsExisting.values();
+        std::sort(addAppRanges.begin(), addAppRanges.end(), [](const EntryRange& lhs, const EntryRange& rhs){ return lhs.offset < rhs.offset; });
+
+        for(const EntryRange& range : qAsConst(addAppRanges))
+        {
+            AddApp existingAddApp;
+            if((finalizeError = readExistingAddApp(existingAddApp, range)).isValid())
+                break;
+
+            writeAddApp(existingAddApp);
+        }
     }
 
-    // Clear existing lists
+    // Clear existing lists and release existing doc
     mGamesExisting.clear();
     mAddAppsExisting.clear();
+    mExistingSourceFile.close();
+    mExistingSource = nullptr;
+
+    return finalizeError;
 }
 
 //===============================================================================================================
@@ -231,111 +750,225 @@ void Xml::PlatformDoc::finalize()
 Xml::PlatformDocReader::PlatformDocReader(PlatformDoc* targetDoc)
     : DataDocReader(targetDoc) {}
 
-//-Instance Functions-------------------------------------------------------------------------------------------------
+//-Class Functions----------------------------------------------------------------------------------------------------
 //Private:
-bool Xml::PlatformDocReader::readTargetDoc()
+QString Xml::PlatformDocReader::readFieldText(QXmlStreamReader& streamReader, RawElementScanner& fieldScanner,
+                                              const RawElementScanner::ElementRange& range)
 {
-    while(mStreamReader.readNextStartElement())
+    // Decode straight from the source, leaving anything unusual to the stream reader
+    QString text;
+    if(XmlText::unescape(text, fieldScanner.rawContent(range)))
     {
-        if(mStreamReader.name() == Element_Game::NAME)
-            parseGame();
-        else if(mStreamReader.name() == Element_AddApp::NAME)
-            parseAddApp();
-        else
-            mStreamReader.skipCurrentElement();
+        streamReader.skipCurrentElement();
+        return text;
     }
-
-    // Return status
-    return mStreamReader.hasError();
+    else
+        return streamReader.readElementText();
 }
 
-void Xml::PlatformDocReader::parseGame()
+Game Xml::PlatformDocReader::parseGame(QXmlStreamReader& streamReader, RawElementScanner& fieldScanner)
 {
     // Game to build
     GameBuilder gb;
 
-    // Cover all children
-    while(mStreamReader.readNextStartElement())
+    // Cover all children, keeping the scanner on the same child as the reader
+    RawElementScanner::ElementRange fieldRange;
+    while(streamReader.readNextStartElement() && fieldScanner.nextElement(fieldRange))
     {
-        if(mStreamReader.name() == Element_Game::ELEMENT_ID)
-            gb.wID(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_TITLE)
-            gb.wTitle(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_SERIES)
-            gb.wSeries(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_DEVELOPER)
-            gb.wDeveloper(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_PUBLISHER)
-            gb.wPublisher(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_PLATFORM)
-            gb.wPlatform(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_SORT_TITLE)
-            gb.wSortTitle(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_DATE_ADDED)
-            gb.wDateAdded(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_DATE_MODIFIED)
-            gb.wDateModified(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_BROKEN)
-            gb.wBroken(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_PLAYMODE)
-            gb.wPlayMode(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_STATUS)
-            gb.wStatus(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_REGION)
-            gb.wRegion(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_NOTES)
-            gb.wNotes(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_SOURCE)
-            gb.wSource(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_APP_PATH)
-            gb.wAppPath(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_COMMAND_LINE)
-            gb.wCommandLine(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_RELEASE_DATE)
-            gb.wReleaseDate(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_VERSION)
-            gb.wVersion(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_Game::ELEMENT_RELEASE_TYPE)
-            gb.wReleaseType(mStreamReader.readElementText());
-        else
-            gb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
+        switch(Element_Game::FIELD_LOOKUP.value(streamReader.name(), Element_Game::FIELD_OTHER))
+        {
+            case Element_Game::FIELD_ID:
+                gb.wID(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_TITLE:
+                gb.wTitle(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_SERIES:
+                gb.wSeries(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_DEVELOPER:
+                gb.wDeveloper(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_PUBLISHER:
+                gb.wPublisher(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_PLATFORM:
+                gb.wPlatform(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_SORT_TITLE:
+                gb.wSortTitle(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_DATE_ADDED:
+                gb.wDateAdded(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_DATE_MODIFIED:
+                gb.wDateModified(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_BROKEN:
+                gb.wBroken(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_PLAYMODE:
+                gb.wPlayMode(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_STATUS:
+                gb.wStatus(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_REGION:
+                gb.wRegion(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_NOTES:
+                gb.wNotes(readFieldText(streamReader, fieldScanner, fieldRange));
+                break;
+            case Element_Game::FIELD_SOURCE:
+                gb.wSource(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_APP_PATH:
+                gb.wAppPath(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_COMMAND_LINE:
+                gb.wCommandLine(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_RELEASE_DATE:
+                gb.wReleaseDate(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_VERSION:
+                gb.wVersion(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_RELEASE_TYPE:
+                gb.wReleaseType(streamReader.readElementText());
+                break;
+            case Element_Game::FIELD_OTHER:
+                gb.wOtherField(fieldScanner.rawBytes(fieldRange));
+                streamReader.skipCurrentElement();
+                break;
+        }
     }
 
-    // Build Game and add to document
-    LB::Game existingGame = gb.build();
-    static_cast<PlatformDoc*>(mTargetDocument)->mGamesExisting[existingGame.getID()] = existingGame;
+    // Build Game
+    return gb.build();
 }
 
-void Xml::PlatformDocReader::parseAddApp()
+AddApp Xml::PlatformDocReader::parseAddApp(QXmlStreamReader& streamReader, RawElementScanner& fieldScanner)
 {
     // Additional App to Build
     AddAppBuilder aab;
 
-    // Cover all children
+    // Cover all children, keeping the scanner on the same child as the reader
+    RawElementScanner::ElementRange fieldRange;
+    while(streamReader.readNextStartElement() && fieldScanner.nextElement(fieldRange))
+    {
+        switch(Element_AddApp::FIELD_LOOKUP.value(streamReader.name(), Element_AddApp::FIELD_OTHER))
+        {
+            case Element_AddApp::FIELD_ID:
+                aab.wID(streamReader.readElementText());
+                break;
+            case Element_AddApp::FIELD_GAME_ID:
+                aab.wGameID(streamReader.readElementText());
+                break;
+            case Element_AddApp::FIELD_APP_PATH:
+                aab.wAppPath(streamReader.readElementText());
+                break;
+            case Element_AddApp::FIELD_COMMAND_LINE:
+                aab.wCommandLine(streamReader.readElementText());
+                break;
+            case Element_AddApp::FIELD_AUTORUN_BEFORE:
+                aab.wAutorunBefore(streamReader.readElementText());
+                break;
+            case Element_AddApp::FIELD_NAME:
+                aab.wName(streamReader.readElementText());
+                break;
+            case Element_AddApp::FIELD_WAIT_FOR_EXIT:
+                aab.wWaitForExit(streamReader.readElementText());
+                break;
+            case Element_AddApp::FIELD_OTHER:
+                aab.wOtherField(fieldScanner.rawBytes(fieldRange));
+                streamReader.skipCurrentElement();
+                break;
+        }
+    }
+
+    // Build Additional App
+    return aab.build();
+}
+
+//-Instance Functions-------------------------------------------------------------------------------------------------
+//Private:
+bool Xml::PlatformDocReader::readTargetDoc()
+{
+    PlatformDoc* platformDoc = static_cast<PlatformDoc*>(mTargetDocument);
+
+    // Map the existing document so entries can be read from it once needed, it is left untouched until the replacement is saved
+    QFile& sourceFile = platformDoc->mExistingSourceFile;
+    uchar* sourceData = sourceFile.open(QFile::ReadOnly) ? sourceFile.map(0, sourceFile.size()) : nullptr;
+    if(!sourceData)
+    {
+        mStreamReader.raiseError(formatDataDocError(ERR_CANT_MAP_EXISTING, mTargetDocument->getHandleTarget()));
+        return false;
+    }
+    platformDoc->mExistingSource = reinterpret_cast<const char*>(sourceData);
+
+    // Index existing entries by ID in one validating pass over the mapping, keeping the scanner on the same entry as the reader
+    QByteArray source = QByteArray::fromRawData(platformDoc->mExistingSource, int(sourceFile.size()));
+    platformDoc->mExistingDigest = QCryptographicHash::hash(source, DigestDevice::ALGORITHM);
+
+    mSourceBuffer.setData(source);
+    mSourceBuffer.open(QIODevice::ReadOnly);
+    mStreamReader.setDevice(&mSourceBuffer);
+    mStreamReader.readNextStartElement(); // Root, already checked
+
+    RawElementScanner docScanner(source, RawElementScanner::firstElement(source));
+    RawElementScanner::ElementRange entryRange;
+
     while(mStreamReader.readNextStartElement())
     {
-        if(mStreamReader.name() == Element_AddApp::ELEMENT_ID)
-            aab.wID(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_AddApp::ELEMENT_GAME_ID)
-            aab.wGameID(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_AddApp::ELEMENT_APP_PATH)
-            aab.wAppPath(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_AddApp::ELEMENT_COMMAND_LINE)
-            aab.wCommandLine(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_AddApp::ELEMENT_AUTORUN_BEFORE)
-            aab.wAutorunBefore(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_AddApp::ELEMENT_NAME)
-            aab.wName(mStreamReader.readElementText());
-        else if(mStreamReader.name() == Element_AddApp::ELEMENT_WAIT_FOR_EXIT)
-            aab.wWaitForExit(mStreamReader.readElementText());
+        if(!docScanner.nextElement(entryRange))
+        {
+            mStreamReader.raiseError(formatDataDocError(ERR_ENTRY_UNREADABLE, mTargetDocument->getHandleTarget()));
+            break;
+        }
+
+        RawElementScanner fieldScanner(source, entryRange.start);
+        if(mStreamReader.name() == Element_Game::NAME)
+            indexEntry<Element_Game>(platformDoc->mGamesExisting, fieldScanner, entryRange);
+        else if(mStreamReader.name() == Element_AddApp::NAME)
+            indexEntry<Element_AddApp>(platformDoc->mAddAppsExisting, fieldScanner, entryRange);
         else
-            aab.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
+            mStreamReader.skipCurrentElement();
     }
 
-    // Build Additional App and add to document
-    LB::AddApp existingAddApp = aab.build();
-    static_cast<PlatformDoc*>(mTargetDocument)->mAddAppsExisting[existingAddApp.getID()] = existingAddApp;
+    // Return status
+    return !mStreamReader.hasError();
+}
 
+template<typename Element>
+void Xml::PlatformDocReader::indexEntry(QHash<QUuid, PlatformDoc::EntryRange>& indexBuffer, RawElementScanner& fieldScanner,
+                                        const RawElementScanner::ElementRange& range)
+{
+    // Read through every field so malformed entries are caught now rather than when they're needed, keeping the scanner on the same field
+    QUuid entryID;
+    RawElementScanner::ElementRange fieldRange;
+    while(mStreamReader.readNextStartElement())
+    {
+        if(!fieldScanner.nextElement(fieldRange))
+        {
+            mStreamReader.raiseError(formatDataDocError(ERR_ENTRY_UNREADABLE, mTargetDocument->getHandleTarget()));
+            return;
+        }
+
+        // Only the ID is decoded, straight from the source
+        if(Element::FIELD_LOOKUP.value(mStreamReader.name(), Element::FIELD_OTHER) == Element::FIELD_ID)
+            entryID = QUuid(readFieldText(mStreamReader, fieldScanner, fieldRange));
+        else
+            mStreamReader.skipCurrentElement();
+    }
+
+    if(mStreamReader.hasError())
+        return;
+
+    if(entryID.isNull())
+        mStreamReader.raiseError(formatDataDocError(ERR_ENTRY_WITHOUT_ID, mTargetDocument->getHandleTarget()));
+    else
+        indexBuffer[entryID] = {range.start, range.end - range.start};
 }
 
 //===============================================================================================================
@@ -351,22 +984,8 @@ Xml::PlatformDocWriter::PlatformDocWriter(PlatformDoc* sourceDoc)
 //Private:
 bool Xml::PlatformDocWriter::writeSourceDoc()
 {
-    // Write all games
-    for(const Game& game : static_cast<PlatformDoc*>(mSourceDocument)->getFinalGames())
-    {
-        if(!writeGame(game))
-            return false;
-    }
-
-    // Write all additional apps
-    for(const AddApp& addApp : static_cast<PlatformDoc*>(mSourceDocument)->getFinalAddApps())
-    {
-        if(!writeAddApp(addApp))
-            return false;
-    }
-
-    // Return true on success
-    return true;
+    // Entries were already written as they were added, just report status
+    return !mStreamWriter.hasError();
 }
 
 bool Xml::PlatformDocWriter::writeGame(const Game& game)
@@ -438,14 +1057,25 @@ bool Xml::PlatformDocWriter::writeAddApp(const AddApp& addApp)
     return !mStreamWriter.hasError();
 }
 
+bool Xml::PlatformDocWriter::writeExistingEntry(const QByteArray& entry)
+{
+    // Entry is already encoded, only its placement is needed
+    mStreamWriter.writeRawElement(entry);
+
+    // Return error status
+    return !mStreamWriter.hasError();
+}
+
 //===============================================================================================================
 // Xml::PlaylistDoc
 //===============================================================================================================
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 //Public:
-Xml::PlaylistDoc::PlaylistDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, Qx::FreeIndexTracker<int>* lbDBFIDT, const Key&)
-    : DataDoc(std::move(xmlFile), DataDocHandle{Xml::PlaylistDoc::TYPE_NAME, docName}), mUpdateOptions(updateOptions), mPlaylistGameFreeLBDBIDTracker(lbDBFIDT) {}
+Xml::PlaylistDoc::PlaylistDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, Qx::FreeIndexTracker<int>* lbDBFIDT,
+                              QMutex* lbDBFIDTMutex, const Key&)
+    : DataDoc(std::move(xmlFile), DataDocHandle{Xml::PlaylistDoc::TYPE_NAME, docName}), mUpdateOptions(updateOptions), mPlaylistGameFreeLBDBIDTracker(lbDBFIDT),
+      mPlaylistGameFreeLBDBIDMutex(lbDBFIDTMutex) {}
 
 //-Instance Functions--------------------------------------------------------------------------------------------------
 //Public:
@@ -485,7 +1115,9 @@ void Xml::PlaylistDoc::addPlaylistGame(PlaylistGame playlistGame)
     }
     else
     {
+        mPlaylistGameFreeLBDBIDMutex->lock();
         playlistGame.setLBDatabaseID(mPlaylistGameFreeLBDBIDTracker->reserveFirstFree());
+        mPlaylistGameFreeLBDBIDMutex->unlock();
         mPlaylistGamesFinal[key] = playlistGame;
     }
 }
@@ -506,18 +1138,23 @@ void Xml::PlaylistDoc::finalize()
 
 //-Constructor--------------------------------------------------------------------------------------------------------
 //Public:
-Xml::PlaylistDocReader::PlaylistDocReader(PlaylistDoc* targetDoc) : DataDocReader(targetDoc) {}
+Xml::PlaylistDocReader::PlaylistDocReader(PlaylistDoc* targetDoc) : DataDocReader(targetDoc, true) {}
 
 //-Instance Functions-------------------------------------------------------------------------------------------------
 //Private:
 bool Xml::PlaylistDocReader::readTargetDoc()
 {
-    while(mStreamReader.readNextStartElement())
+    RawElementScanner docScanner(mSource, RawElementScanner::firstElement(mSource));
+    RawElementScanner::ElementRange entryRange;
+
+    while(mStreamReader.readNextStartElement() && docScanner.nextElement(entryRange))
     {
+        RawElementScanner fieldScanner(mSource, entryRange.start);
+
         if(mStreamReader.name() == Element_PlaylistHeader::NAME)
-            parsePlaylistHeader();
+            parsePlaylistHeader(fieldScanner);
         else if(mStreamReader.name() == Element_PlaylistGame::NAME)
-            parsePlaylistGame();
+            parsePlaylistGame(fieldScanner);
         else
             mStreamReader.skipCurrentElement();
     }
@@ -526,13 +1163,14 @@ bool Xml::PlaylistDocReader::readTargetDoc()
     return mStreamReader.hasError();
 }
 
-void Xml::PlaylistDocReader::parsePlaylistHeader()
+void Xml::PlaylistDocReader::parsePlaylistHeader(RawElementScanner& fieldScanner)
 {
     // Playlist Header to Build
     PlaylistHeaderBuilder phb;
 
-    // Cover all children
-    while(mStreamReader.readNextStartElement())
+    // Cover all children, keeping the scanner on the same child as the reader
+    RawElementScanner::ElementRange fieldRange;
+    while(mStreamReader.readNextStartElement() && fieldScanner.nextElement(fieldRange))
     {
         if(mStreamReader.name() == Element_PlaylistHeader::ELEMENT_ID)
             phb.wPlaylistID(mStreamReader.readElementText());
@@ -543,7 +1181,10 @@ void Xml::PlaylistDocReader::parsePlaylistHeader()
         else if(mStreamReader.name() == Element_PlaylistHeader::ELEMENT_NOTES)
             phb.wNotes(mStreamReader.readElementText());
         else
-            phb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
+        {
+            phb.wOtherField(fieldScanner.rawBytes(fieldRange));
+            mStreamReader.skipCurrentElement();
+        }
     }
 
     // Build Playlist Header and add to document
@@ -551,13 +1192,14 @@ void Xml::PlaylistDocReader::parsePlaylistHeader()
 
 }
 
-void Xml::PlaylistDocReader::parsePlaylistGame()
+void Xml::PlaylistDocReader::parsePlaylistGame(RawElementScanner& fieldScanner)
 {
     // Playlist Game to Build
     PlaylistGameBuilder pgb;
 
-    // Cover all children
-    while(mStreamReader.readNextStartElement())
+    // Cover all children, keeping the scanner on the same child as the reader
+    RawElementScanner::ElementRange fieldRange;
+    while(mStreamReader.readNextStartElement() && fieldScanner.nextElement(fieldRange))
     {
         if(mStreamReader.name() == Element_PlaylistGame::ELEMENT_ID)
             pgb.wGameID(mStreamReader.readElementText());
@@ -572,13 +1214,17 @@ void Xml::PlaylistDocReader::parsePlaylistGame()
         else if(mStreamReader.name() == Element_PlaylistGame::ELEMENT_LB_DB_ID)
             pgb.wLBDatabaseID(mStreamReader.readElementText());
         else
-            pgb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
+        {
+            pgb.wOtherField(fieldScanner.rawBytes(fieldRange));
+            mStreamReader.skipCurrentElement();
+        }
     }
 
     // Build Playlist Game
     LB::PlaylistGame existingPlaylistGame = pgb.build();
 
     // Correct LB ID if it is invalid and then add it to tracker
+    QMutexLocker trackerLocker(static_cast<PlaylistDoc*>(mTargetDocument)->mPlaylistGameFreeLBDBIDMutex);
     if(existingPlaylistGame.getLBDatabaseID() < 0)
         existingPlaylistGame.setLBDatabaseID(static_cast<PlaylistDoc*>(mTargetDocument)->mPlaylistGameFreeLBDBIDTracker->reserveFirstFree());
     else
@@ -607,8 +1253,13 @@ bool Xml::PlaylistDocWriter::writeSourceDoc()
     if(!writePlaylistHeader(static_cast<PlaylistDoc*>(mSourceDocument)->getPlaylistHeader()))
         return false;
 
-    // Write all playlist games
-    for(const PlaylistGame& playlistGame : static_cast<PlaylistDoc*>(mSourceDocument)->getFinalPlaylistGames())
+    // Write all playlist games, in a stable order so that repeat imports give identical docs
+    QList<PlaylistGame> playlistGames = static_cast<PlaylistDoc*>(mSourceDocument)->getFinalPlaylistGames().values();
+    std::sort(playlistGames.begin(), playlistGames.end(), [](const PlaylistGame& lhs, const PlaylistGame& rhs){
+        return lhs.getManualOrder() != rhs.getManualOrder() ? lhs.getManualOrder() < rhs.getManualOrder() : lhs.getGameID() < rhs.getGameID();
+    });
+
+    for(const PlaylistGame& playlistGame : qAsConst(playlistGames))
     {
         if(!writePlaylistGame(playlistGame))
             return false;
@@ -692,20 +1343,25 @@ void Xml::PlatformsDoc::setMediaFolder(QString platform, QString mediaType, QStr
 //-Constructor--------------------------------------------------------------------------------------------------------
 //Public:
 Xml::PlatformsDocReader::PlatformsDocReader(Xml::PlatformsDoc* targetDoc)
-    : DataDocReader(targetDoc) {}
+    : DataDocReader(targetDoc, true) {}
 
 //-Instance Functions-------------------------------------------------------------------------------------------------
 //Private:
 bool Xml::PlatformsDocReader::readTargetDoc()
 {
-    while(mStreamReader.readNextStartElement())
+    RawElementScanner docScanner(mSource, RawElementScanner::firstElement(mSource));
+    RawElementScanner::ElementRange entryRange;
+
+    while(mStreamReader.readNextStartElement() && docScanner.nextElement(entryRange))
     {
+        RawElementScanner fieldScanner(mSource, entryRange.start);
+
         if(mStreamReader.name() == Element_Platform::NAME)
-            parsePlatform();
+            parsePlatform(fieldScanner);
         else if(mStreamReader.name() == Element_PlatformFolder::NAME)
             parsePlatformFolder();
         else if (mStreamReader.name() == Element_PlatformCategory::NAME)
-            parsePlatformCategory();
+            parsePlatformCategory(fieldScanner);
         else
             mStreamReader.skipCurrentElement();
     }
@@ -714,18 +1370,22 @@ bool Xml::PlatformsDocReader::readTargetDoc()
     return mStreamReader.hasError();
 }
 
-void Xml::PlatformsDocReader::parsePlatform()
+void Xml::PlatformsDocReader::parsePlatform(RawElementScanner& fieldScanner)
 {
     // Platform Config Doc to Build
     PlatformBuilder pb;
 
-    // Cover all children
-    while(mStreamReader.readNextStartElement())
+    // Cover all children, keeping the scanner on the same child as the reader
+    RawElementScanner::ElementRange fieldRange;
+    while(mStreamReader.readNextStartElement() && fieldScanner.nextElement(fieldRange))
     {
         if(mStreamReader.name() == Element_Platform::ELEMENT_NAME)
             pb.wName(mStreamReader.readElementText());
         else
-            pb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
+        {
+            pb.wOtherField(fieldScanner.rawBytes(fieldRange));
+            mStreamReader.skipCurrentElement();
+        }
     }
 
     // Build Platform and add to document
@@ -757,16 +1417,18 @@ void Xml::PlatformsDocReader::parsePlatformFolder()
     static_cast<PlatformsDoc*>(mTargetDocument)->mPlatformFolders[platform][mediaType] = folderPath;
 }
 
-void Xml::PlatformsDocReader::parsePlatformCategory()
+void Xml::PlatformsDocReader::parsePlatformCategory(RawElementScanner& fieldScanner)
 {
     // Platform Config Doc to Build
     PlatformCategoryBuilder pcb;
 
-    // Cover all children
-    while(mStreamReader.readNextStartElement())
+    // Cover all children, keeping the scanner on the same child as the reader
+    RawElementScanner::ElementRange fieldRange;
+    while(mStreamReader.readNextStartElement() && fieldScanner.nextElement(fieldRange))
     {
         // No specific elements are of interest for now
-        pcb.wOtherField({mStreamReader.name().toString(), mStreamReader.readElementText()});
+        pcb.wOtherField(fieldScanner.rawBytes(fieldRange));
+        mStreamReader.skipCurrentElement();
     }
 
     // Build Playlist Header and add to document
@@ -786,10 +1448,14 @@ Xml::PlatformsDocWriter::PlatformsDocWriter(PlatformsDoc* sourceDoc)
 //Private:
 bool Xml::PlatformsDocWriter::writeSourceDoc()
 {
-    // Write all platforms
-    for(const Platform& platform : static_cast<PlatformsDoc*>(mSourceDocument)->getPlatforms())
+    // Write all platforms, in a stable order so that repeat imports give identical docs
+    const QHash<QString, Platform>& platforms = static_cast<PlatformsDoc*>(mSourceDocument)->getPlatforms();
+    QStringList platformNames = platforms.keys();
+    platformNames.sort();
+
+    for(const QString& platformName : qAsConst(platformNames))
     {
-        if(!writePlatform(platform))
+        if(!writePlatform(platforms.value(platformName)))
             return false;
     }
 
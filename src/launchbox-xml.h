@@ -3,10 +3,16 @@
 
 #include <QString>
 #include <QFile>
+#include <QSaveFile>
+#include <QCryptographicHash>
+#include <QBuffer>
+#include <QSet>
+#include <QMutex>
 #include <memory>
 #include "qx.h"
 #include "qx-xml.h"
 #include "launchbox.h"
+#include "launchbox-xml-text.h"
 
 namespace LB {
 
@@ -71,6 +77,21 @@ public:
         static inline const QString ELEMENT_RELEASE_DATE = "ReleaseDate";
         static inline const QString ELEMENT_VERSION = "Version";
         static inline const QString ELEMENT_RELEASE_TYPE = "ReleaseType";
+
+        // Known elements resolved by lookup rather than comparing against each name
+        enum Field {FIELD_OTHER, FIELD_ID, FIELD_TITLE, FIELD_SERIES, FIELD_DEVELOPER, FIELD_PUBLISHER, FIELD_PLATFORM, FIELD_SORT_TITLE,
+                    FIELD_DATE_ADDED, FIELD_DATE_MODIFIED, FIELD_BROKEN, FIELD_PLAYMODE, FIELD_STATUS, FIELD_REGION, FIELD_NOTES, FIELD_SOURCE,
+                    FIELD_APP_PATH, FIELD_COMMAND_LINE, FIELD_RELEASE_DATE, FIELD_VERSION, FIELD_RELEASE_TYPE};
+
+        static inline const QHash<QStringView, Field> FIELD_LOOKUP = {{ELEMENT_ID, FIELD_ID}, {ELEMENT_TITLE, FIELD_TITLE}, {ELEMENT_SERIES, FIELD_SERIES},
+                                                                      {ELEMENT_DEVELOPER, FIELD_DEVELOPER}, {ELEMENT_PUBLISHER, FIELD_PUBLISHER},
+                                                                      {ELEMENT_PLATFORM, FIELD_PLATFORM}, {ELEMENT_SORT_TITLE, FIELD_SORT_TITLE},
+                                                                      {ELEMENT_DATE_ADDED, FIELD_DATE_ADDED}, {ELEMENT_DATE_MODIFIED, FIELD_DATE_MODIFIED},
+                                                                      {ELEMENT_BROKEN, FIELD_BROKEN}, {ELEMENT_PLAYMODE, FIELD_PLAYMODE},
+                                                                      {ELEMENT_STATUS, FIELD_STATUS}, {ELEMENT_REGION, FIELD_REGION}, {ELEMENT_NOTES, FIELD_NOTES},
+                                                                      {ELEMENT_SOURCE, FIELD_SOURCE}, {ELEMENT_APP_PATH, FIELD_APP_PATH},
+                                                                      {ELEMENT_COMMAND_LINE, FIELD_COMMAND_LINE}, {ELEMENT_RELEASE_DATE, FIELD_RELEASE_DATE},
+                                                                      {ELEMENT_VERSION, FIELD_VERSION}, {ELEMENT_RELEASE_TYPE, FIELD_RELEASE_TYPE}};
     };
 
     class Element_AddApp
@@ -85,6 +106,13 @@ public:
         static inline const QString ELEMENT_AUTORUN_BEFORE = "AutoRunBefore";
         static inline const QString ELEMENT_NAME = "Name";
         static inline const QString ELEMENT_WAIT_FOR_EXIT = "WaitForExit";
+
+        // Known elements resolved by lookup rather than comparing against each name
+        enum Field {FIELD_OTHER, FIELD_ID, FIELD_GAME_ID, FIELD_APP_PATH, FIELD_COMMAND_LINE, FIELD_AUTORUN_BEFORE, FIELD_NAME, FIELD_WAIT_FOR_EXIT};
+
+        static inline const QHash<QStringView, Field> FIELD_LOOKUP = {{ELEMENT_ID, FIELD_ID}, {ELEMENT_GAME_ID, FIELD_GAME_ID}, {ELEMENT_APP_PATH, FIELD_APP_PATH},
+                                                                      {ELEMENT_COMMAND_LINE, FIELD_COMMAND_LINE}, {ELEMENT_AUTORUN_BEFORE, FIELD_AUTORUN_BEFORE},
+                                                                      {ELEMENT_NAME, FIELD_NAME}, {ELEMENT_WAIT_FOR_EXIT, FIELD_WAIT_FOR_EXIT}};
     };
 
     class Element_PlaylistHeader
@@ -135,6 +163,66 @@ public:
         static inline const QString NAME = "PlatformCategory";
     };
 
+    class RawElementScanner
+    {
+    //-Class Structs-------------------------------------------------------------------------------------------------------
+    public:
+        struct ElementRange
+        {
+            int leadingStart; // Whitespace and markup since the previous sibling
+            int start;
+            int end;
+        };
+
+    //-Instance Variables--------------------------------------------------------------------------------------------------
+    private:
+        QByteArray mSource;
+        int mCursor;
+
+    //-Constructor--------------------------------------------------------------------------------------------------------
+    public:
+        RawElementScanner(const QByteArray& source, int parentStart); // Scans the children of the element starting at parentStart, or top-level elements if -1
+
+    //-Class Functions----------------------------------------------------------------------------------------------------
+    public:
+        static int firstElement(const QByteArray& source);
+
+    //-Instance Functions-------------------------------------------------------------------------------------------------
+    private:
+        int tagEnd(int tagStart) const;
+        int markupEnd(int markupStart) const;
+
+    public:
+        bool nextElement(ElementRange& rangeBuffer);
+        QByteArray rawBytes(const ElementRange& range) const; // Element and markup before it, shares the source's data so only valid while it is
+        QByteArray rawContent(const ElementRange& range) const; // Between the element's tags, shared like rawBytes()
+    };
+
+    class DigestDevice : public QIODevice
+    {
+    //-Class Variables-----------------------------------------------------------------------------------------------------
+    public:
+        static inline const QCryptographicHash::Algorithm ALGORITHM = QCryptographicHash::Md5;
+
+    //-Instance Variables--------------------------------------------------------------------------------------------------
+    private:
+        QIODevice* mTarget;
+        QCryptographicHash mHash;
+
+    //-Constructor--------------------------------------------------------------------------------------------------------
+    public:
+        DigestDevice(QIODevice* target); // Write-only pass through that hashes everything written
+
+    //-Instance Functions-------------------------------------------------------------------------------------------------
+    protected:
+        qint64 readData(char* data, qint64 maxSize) override;
+        qint64 writeData(const char* data, qint64 maxSize) override;
+
+    public:
+        bool isSequential() const override;
+        QByteArray digest() const;
+    };
+
     class DataDoc
     {
         friend class DataDocReader;
@@ -152,7 +240,10 @@ public:
 
     //-Instance Variables--------------------------------------------------------------------------------------------------
     protected:
-        std::unique_ptr<QFile> mDocumentFile;
+        std::unique_ptr<QFile> mDocumentFile; // Existing document, only read
+        QSaveFile mDocumentSaveFile; // Replacement, swapped in for the existing document once saved
+        DigestDevice mDocumentWriteDevice; // Writes to the replacement
+        QByteArray mExistingDigest; // Of the existing document, if read
         DataDocHandle mHandleTarget;
 
     //-Constructor--------------------------------------------------------------------------------------------------------
@@ -162,7 +253,6 @@ public:
     //-Instance Functions--------------------------------------------------------------------------------------------------
     public:
         DataDocHandle getHandleTarget() const;
-        void clearFile();
     };
 
     class DataDocReader
@@ -172,9 +262,14 @@ public:
         DataDoc* mTargetDocument;
         QXmlStreamReader mStreamReader;
 
+        // Whole document, only loaded for readers that locate unknown fields by byte position
+        bool mLoadSource;
+        QByteArray mSource;
+        QBuffer mSourceBuffer;
+
     //-Constructor--------------------------------------------------------------------------------------------------------
     public:
-        DataDocReader(DataDoc* targetDoc);
+        DataDocReader(DataDoc* targetDoc, bool loadSource = false);
 
     //-Instance Functions-------------------------------------------------------------------------------------------------
     private:
@@ -184,12 +279,77 @@ public:
         Qx::XmlStreamReaderError readInto();
     };
 
+    // Produces the same output as an auto-formatting QXmlStreamWriter (2 space indent), but from a large buffer with
+    // pre-encoded tags and indents
+    class BufferedStreamWriter
+    {
+    //-Class Structs-------------------------------------------------------------------------------------------------------
+    private:
+        struct Tag
+        {
+            QByteArray start; // "<Name"
+            QByteArray end; // "</Name>"
+        };
+
+    //-Class Variables-----------------------------------------------------------------------------------------------------
+    public:
+        static inline const int BUFFER_SIZE = 1 << 18; // Flushed to the device once reached
+        static inline const int INDENT_WIDTH = 2;
+        static inline const QByteArray DOCUMENT_START = R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>)";
+
+    //-Instance Variables--------------------------------------------------------------------------------------------------
+    private:
+        QIODevice* mDevice;
+        QByteArray mBuffer;
+        bool mHasError;
+
+        // Pre-encoded output
+        QHash<QString, int> mTagIndices;
+        QVector<Tag> mTags;
+        QVector<QByteArray> mIndents;
+
+        // Formatting state, mirrors QXmlStreamWriter
+        QVector<int> mTagStack;
+        bool mInStartElement;
+        bool mInEmptyElement;
+        bool mWroteSomething;
+        bool mLastWasStartElement;
+
+    //-Constructor--------------------------------------------------------------------------------------------------------
+    public:
+        BufferedStreamWriter();
+
+    //-Instance Functions-------------------------------------------------------------------------------------------------
+    private:
+        void append(const char* data, int size);
+        void append(const QByteArray& data);
+        void appendIndent(int level);
+        void appendEscaped(const QString& text);
+        int tagIndex(const QString& name);
+        bool finishStartElement(bool contents = true);
+
+    public:
+        void setDevice(QIODevice* device);
+        QIODevice* device() const;
+        bool hasError() const;
+
+        void writeStartDocument();
+        void writeEndDocument();
+        void writeStartElement(const QString& name);
+        void writeEndElement();
+        void writeEmptyElement(const QString& name);
+        void writeTextElement(const QString& name, const QString& text);
+        void writeCharacters(const QString& text);
+        void writeRawElement(const QByteArray& element); // Inserted as is, indented as a child of the current element
+        bool flush();
+    };
+
     class DataDocWriter
     {
     //-Instance Variables--------------------------------------------------------------------------------------------------
     protected:
         DataDoc* mSourceDocument;
-        QXmlStreamWriter mStreamWriter;
+        BufferedStreamWriter mStreamWriter;
 
     //-Constructor--------------------------------------------------------------------------------------------------------
     public:
@@ -199,9 +359,10 @@ public:
     protected:
         virtual bool writeSourceDoc() = 0;
         void writeEmptyCheckedTextElement(const QString &qualifiedName, const QString &text);
-        void writeOtherFields(const QHash<QString, QString>& otherFields);
+        void writeOtherFields(const QByteArray& otherFields);
 
     public:
+        void beginDocument(); // Only needed to write entries before writeOutOf(), does nothing once started
         QString writeOutOf();
     };
 
@@ -222,6 +383,14 @@ public:
         friend class PlatformDocWriter;
         friend class Install;
 
+    //-Class Structs-------------------------------------------------------------------------------------------------------
+    private:
+        struct EntryRange
+        {
+            int offset;
+            int length;
+        };
+
     //-Class Variables-----------------------------------------------------------------------------------------------------
     public:
         static inline const QString TYPE_NAME = "Platform";
@@ -230,47 +399,72 @@ public:
     private:
         UpdateOptions mUpdateOptions;
 
-        QHash<QUuid, Game> mGamesFinal;
-        QHash<QUuid, Game> mGamesExisting;
-        QHash<QUuid, AddApp> mAddAppsFinal;
-        QHash<QUuid, AddApp> mAddAppsExisting;
+        // Entries are written as soon as they are added
+        std::unique_ptr<PlatformDocWriter> mDocWriter;
+        QHash<QUuid, PlaylistGame::EntryDetails> mFinalGameDetails;
+        QSet<QUuid> mFinalAddAppIDs;
+        bool mGamesFinished; // Games all precede the additional apps, so kept existing games are written before the first one
+
+        // Existing entries are located in the existing doc and only parsed once needed
+        QFile mExistingSourceFile;
+        const char* mExistingSource;
+        QHash<QUuid, EntryRange> mGamesExisting;
+        QHash<QUuid, EntryRange> mAddAppsExisting;
 
     //-Constructor--------------------------------------------------------------------------------------------------------
     public:
-        explicit PlatformDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, const Key&);
+        explicit PlatformDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, QString existingSourcePath, const Key&);
 
     //-Instance Functions--------------------------------------------------------------------------------------------------
+    private:
+        Qx::XmlStreamReaderError readExistingGame(Game& gameBuffer, EntryRange range) const;
+        Qx::XmlStreamReaderError readExistingAddApp(AddApp& addAppBuffer, EntryRange range) const;
+        void writeGame(const Game& game);
+        void writeAddApp(const AddApp& app);
+        Qx::XmlStreamReaderError finishGames();
+
     public:
-        const QHash<QUuid, Game>& getFinalGames() const;
-        const QHash<QUuid, AddApp>& getFinalAddApps() const;
+        const QHash<QUuid, PlaylistGame::EntryDetails>& getFinalGameDetails() const;
 
         bool containsGame(QUuid gameID) const;
         bool containsAddApp(QUuid addAppId) const;
 
-        void addGame(Game game);
-        void addAddApp(AddApp app);
+        Qx::XmlStreamReaderError addGame(Game game, bool existingIsCurrent = false); // Existing entry is copied as is when known to already match
+        Qx::XmlStreamReaderError addAddApp(AddApp app, bool existingIsCurrent = false);
+        Qx::XmlStreamReaderError keepExistingGame(QUuid gameID, const PlaylistGame::EntryDetails& details); // Copies the entry as is
+        Qx::XmlStreamReaderError keepExistingAddApp(QUuid addAppID);
 
-        void finalize();
+        Qx::XmlStreamReaderError finalize();
     };
 
     class PlatformDocReader : public DataDocReader
     {
+        friend class PlatformDoc;
+
     //-Constructor--------------------------------------------------------------------------------------------------------
     public:
         PlatformDocReader(PlatformDoc* targetDoc);
 
+    //-Class Functions----------------------------------------------------------------------------------------------------
+    private:
+        static QString readFieldText(QXmlStreamReader& streamReader, RawElementScanner& fieldScanner, const RawElementScanner::ElementRange& range);
+        static Game parseGame(QXmlStreamReader& streamReader, RawElementScanner& fieldScanner);
+        static AddApp parseAddApp(QXmlStreamReader& streamReader, RawElementScanner& fieldScanner);
+
     //-Instance Functions-------------------------------------------------------------------------------------------------
     public:
         Qx::XmlStreamReaderError readInto();
 
     private:
         bool readTargetDoc();
-        void parseGame();
-        void parseAddApp();
+        template<typename Element>
+        void indexEntry(QHash<QUuid, PlatformDoc::EntryRange>& indexBuffer, RawElementScanner& fieldScanner, const RawElementScanner::ElementRange& range);
     };
 
     class PlatformDocWriter : public DataDocWriter
     {
+        friend class PlatformDoc;
+
     //-Constructor--------------------------------------------------------------------------------------------------------
     public:
         PlatformDocWriter(PlatformDoc* sourceDoc);
@@ -280,6 +474,7 @@ public:
         bool writeSourceDoc();
         bool writeGame(const Game& game);
         bool writeAddApp(const AddApp& addApp);
+        bool writeExistingEntry(const QByteArray& entry);
     };
 
     class PlaylistDoc : public DataDoc
@@ -296,6 +491,7 @@ public:
     private:
         UpdateOptions mUpdateOptions;
         Qx::FreeIndexTracker<int>* mPlaylistGameFreeLBDBIDTracker;
+        QMutex* mPlaylistGameFreeLBDBIDMutex; // Tracker is shared by all playlist docs, which may be read on other threads
 
         PlaylistHeader mPlaylistHeader;
         QHash<QUuid, PlaylistGame> mPlaylistGamesFinal;
@@ -303,7 +499,8 @@ public:
 
     //-Constructor--------------------------------------------------------------------------------------------------------
     public:
-        explicit PlaylistDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, Qx::FreeIndexTracker<int>* lbDBFIDT, const Key&);
+        explicit PlaylistDoc(std::unique_ptr<QFile> xmlFile, QString docName, UpdateOptions updateOptions, Qx::FreeIndexTracker<int>* lbDBFIDT,
+                             QMutex* lbDBFIDTMutex, const Key&);
 
     //-Instance Functions--------------------------------------------------------------------------------------------------
     public:
@@ -330,8 +527,8 @@ public:
 
     private:
         bool readTargetDoc();
-        void parsePlaylistHeader();
-        void parsePlaylistGame();
+        void parsePlaylistHeader(RawElementScanner& fieldScanner);
+        void parsePlaylistGame(RawElementScanner& fieldScanner);
     };
 
     class PlaylistDocWriter : public DataDocWriter
@@ -390,9 +587,9 @@ public:
     //-Instance Functions-------------------------------------------------------------------------------------------------
     private:
         bool readTargetDoc();
-        void parsePlatform();
+        void parsePlatform(RawElementScanner& fieldScanner);
         void parsePlatformFolder();
-        void parsePlatformCategory();
+        void parsePlatformCategory(RawElementScanner& fieldScanner);
     };
 
     class PlatformsDocWriter : public DataDocWriter
@@ -417,7 +614,11 @@ public:
     static inline const QString ERR_BAK_WONT_DEL = "The existing backup of the target XML file (%1 | %2) could not be removed.";
     static inline const QString ERR_CANT_MAKE_BAK = "Could not create a backup of the target XML file (%1 | %2).";
     static inline const QString ERR_DOC_TYPE_MISMATCH = "The document (%1 | %2) contained an element that belongs to a different document type than expected.";
+    static inline const QString ERR_CANT_MAP_EXISTING = "The existing target XML file (%1 | %2) could not be mapped for reading.";
     static inline const QString ERR_WRITE_FAILED = "Writing to the target XML file (%1 | %2) failed";
+    static inline const QString ERR_ENTRY_WITHOUT_ID = "The target XML file (%1 | %2) contains an entry without a valid ID.";
+    static inline const QString ERR_ENTRY_UNREADABLE = "An entry of the target XML file (%1 | %2) could not be read back.";
+    static inline const QString ERR_ENTRY_MISSING = "The target XML file (%1 | %2) is missing an entry it had when last imported.";
 
     static inline const QString XML_ROOT_ELEMENT = "LaunchBox";
 
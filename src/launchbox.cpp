@@ -15,10 +15,10 @@ Item::Item() {}
 
 //-Instance Functions------------------------------------------------------------------------------------------------
 //Public:
-QHash<QString, QString>& Item::getOtherFields() { return mOtherFields; }
-const QHash<QString, QString>& Item::getOtherFields() const { return mOtherFields; }
+QByteArray& Item::getOtherFields() { return mOtherFields; }
+const QByteArray& Item::getOtherFields() const { return mOtherFields; }
 
-void Item::transferOtherFields(QHash<QString, QString>& otherFields) { mOtherFields = std::move(otherFields); }
+void Item::transferOtherFields(QByteArray& otherFields) { mOtherFields = std::move(otherFields); }
 
 //===============================================================================================================
 // ITEM BUILDER
@@ -30,7 +30,7 @@ void Item::transferOtherFields(QHash<QString, QString>& otherFields) { mOtherFie
 
 //-Instance Functions------------------------------------------------------------------------------------------------
 //Public:
-//B& wOtherField(QPair<QString, QString> otherField) { defined in .h }
+//B& wOtherField(const QByteArray& rawOtherField) { defined in .h }
 //T build() { defined in .h }
 
 //===============================================================================================================
@@ -4,6 +4,7 @@
 #include <QString>
 #include <QDateTime>
 #include <QSet>
+#include <QDataStream>
 #include "flashpoint.h"
 #include "qx.h"
 
@@ -21,18 +22,18 @@ class Item
     friend class ItemBuilder;
 //-Instance Variables-----------------------------------------------------------------------------------------------
 private:
-    QHash<QString, QString> mOtherFields;
+    QByteArray mOtherFields; // Unknown child elements as they appeared in the source XML, without the whitespace between them
 
 //-Constructor-------------------------------------------------------------------------------------------------
 public:
     Item();
 
-    QHash<QString, QString>& getOtherFields();
-    const QHash<QString, QString>& getOtherFields() const;
+    QByteArray& getOtherFields();
+    const QByteArray& getOtherFields() const;
 
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
-    void transferOtherFields(QHash<QString, QString>& otherFields);
+    void transferOtherFields(QByteArray& otherFields);
 };
 
 template <typename B, typename T, ENABLE_IF2(std::is_base_of<Item, T>)>
@@ -48,9 +49,9 @@ protected:
 
 //-Instance Functions------------------------------------------------------------------------------------------
 public:
-    B& wOtherField(QPair<QString, QString> otherField)
+    B& wOtherField(const QByteArray& rawOtherField)
     {
-        mItemBlueprint.mOtherFields[otherField.first] = otherField.second;
+        mItemBlueprint.mOtherFields.append(rawOtherField);
         return static_cast<B&>(*this);
     }
     T build() { return mItemBlueprint; }
@@ -243,6 +244,16 @@ public:
         QString title;
         QString fileName;
         QString platform;
+
+        friend QDataStream& operator<< (QDataStream& stream, const EntryDetails& details)
+        {
+            return stream << details.title << details.fileName << details.platform;
+        }
+
+        friend QDataStream& operator>> (QDataStream& stream, EntryDetails& details)
+        {
+            return stream >> details.title >> details.fileName >> details.platform;
+        }
     };
 
 //-Instance Variables-----------------------------------------------------------------------------------------------
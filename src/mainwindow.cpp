@@ -10,6 +10,7 @@
 #include <QDesktopServices>
 #include <QUrl>
 #include <QShowEvent>
+#include <QCloseEvent>
 #include <filesystem>
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
@@ -112,7 +113,8 @@ void MainWindow::initializeForms()
 
     mArgedImageModeHelp = MSG_IMAGE_MODE_HELP.arg(ui->radioButton_copy->text(),
                                                    ui->radioButton_reference->text(),
-                                                   ui->radioButton_link->text());
+                                                   ui->radioButton_link->text(),
+                                                   ui->radioButton_hardLink->text());
 
     // Setup main forms
     ui->radioButton_link->setEnabled(mHasLinkPermissions);
@@ -136,8 +138,8 @@ void MainWindow::initializeWidgetEnableConditionMap()
                                                                        isExistingPlaylistSelected() ||
                                                                        getSelectedPlaylistGameMode() ==  LB::Install::ForceAll;};
     mWidgetEnableConditionMap[ui->groupBox_imageMode] = [&](){ return mLaunchBoxInstall && mFlashpointInstall; };
-    mWidgetEnableConditionMap[ui->pushButton_startImport] = [&](){ return getSelectedPlatforms().count() > 0 ||
-                                                                          (getSelectedPlaylistGameMode() == LB::Install::ForceAll && getSelectedPlaylists().count() > 0); };
+    mWidgetEnableConditionMap[ui->pushButton_startImport] = [&](){ return !mImportThread && (getSelectedPlatforms().count() > 0 ||
+                                                                          (getSelectedPlaylistGameMode() == LB::Install::ForceAll && getSelectedPlaylists().count() > 0)); };
 }
 
 void MainWindow::checkManualInstallInput(Install install)
@@ -521,7 +523,9 @@ LB::UpdateOptions MainWindow::getSelectedUpdateOptions() const
 
 LB::Install::ImageMode MainWindow::getSelectedImageMode() const
 {
-    return ui->radioButton_copy->isChecked() ? LB::Install::Copy : ui->radioButton_reference->isChecked() ? LB::Install::Reference : LB::Install::Link;
+    return ui->radioButton_copy->isChecked() ? LB::Install::Copy :
+           ui->radioButton_reference->isChecked() ? LB::Install::Reference :
+           ui->radioButton_hardLink->isChecked() ? LB::Install::HardLink : LB::Install::Link;
 }
 
 LB::Install::PlaylistGameMode MainWindow::getSelectedPlaylistGameMode() const
@@ -582,34 +586,44 @@ void MainWindow::prepareImport()
         // Force show progress immediately
         QApplication::processEvents();
 
-        // Setup import worker
-        ImportWorker importWorker(mFlashpointInstall, mLaunchBoxInstall,
-                                  {selPlatforms, selPlaylists},
-                                  {getSelectedUpdateOptions(), getSelectedImageMode(), getSelectedPlaylistGameMode(), getSelectedInclusionOptions()});
+        // Setup import worker and the thread it will run on, no other import can be started until it's done
+        QThread* importThread = new QThread();
+        ImportWorker* importWorker = new ImportWorker(mFlashpointInstall, mLaunchBoxInstall,
+                                                      {selPlatforms, selPlaylists},
+                                                      {getSelectedUpdateOptions(), getSelectedImageMode(), getSelectedPlaylistGameMode(), getSelectedInclusionOptions()});
+        importWorker->moveToThread(importThread);
+        mImportThread = importThread;
+        mImportWorker = importWorker;
+        refreshWidgetEnableStates();
 
         // Setup blocking error connection
-        connect(&importWorker, &ImportWorker::blockingErrorOccured, this, &MainWindow::handleBlockingError);
+        connect(importWorker, &ImportWorker::blockingErrorOccured, this, &MainWindow::handleBlockingError, Qt::BlockingQueuedConnection);
+
+        // Create process update connections (queued since the worker lives in another thread)
+        connect(importWorker, &ImportWorker::progressStepChanged, mImportProgressDialog.get(), &QProgressDialog::setLabelText);
+        connect(importWorker, &ImportWorker::progressMaximumChanged, mImportProgressDialog.get(), &QProgressDialog::setMaximum);
+        connect(importWorker, &ImportWorker::progressMaximumChanged, tbProgress, &QWinTaskbarProgress::setMaximum);
+        connect(importWorker, &ImportWorker::progressValueChanged, mImportProgressDialog.get(), &QProgressDialog::setValue);
+        connect(importWorker, &ImportWorker::progressValueChanged, tbProgress, &QWinTaskbarProgress::setValue);
 
-        // Create process update connections
-        connect(&importWorker, &ImportWorker::progressStepChanged, mImportProgressDialog.get(), &QProgressDialog::setLabelText);
-        connect(&importWorker, &ImportWorker::progressMaximumChanged, mImportProgressDialog.get(), &QProgressDialog::setMaximum);
-        connect(&importWorker, &ImportWorker::progressMaximumChanged, tbProgress, &QWinTaskbarProgress::setMaximum);
-        connect(&importWorker, &ImportWorker::progressValueChanged, mImportProgressDialog.get(), &QProgressDialog::setValue);
-        connect(&importWorker, &ImportWorker::progressValueChanged, tbProgress, &QWinTaskbarProgress::setValue);
-        connect(mImportProgressDialog.get(), &QProgressDialog::canceled, &importWorker, &ImportWorker::notifyCanceled);
+        // Cancel must be direct as the worker's event loop is busy for the duration of the import
+        connect(mImportProgressDialog.get(), &QProgressDialog::canceled, importWorker, &ImportWorker::notifyCanceled, Qt::DirectConnection);
+        connect(mImportProgressDialog.get(), &QProgressDialog::canceled, this, &MainWindow::handleImportCanceled);
 
         // Create UI update timer reset connection
         //connect(&importWorker, &ImportWorker::progressValueChanged, this, &MainWindow::resetUpdateTimer); // Reset refresh timer since setValue already processes events
 
-        // Import error tracker
-        Qx::GenericError importError;
-
         // Start UI update timer
         //mUIUpdateWorkaroundTimer.start();
 
-        // Start import and forward result to handler
-        ImportWorker::ImportResult importResult = importWorker.doImport(importError);
-        handleImportResult(importResult, importError);
+        // Forward result to handler and cleanup once the import has finished
+        connect(importWorker, &ImportWorker::importCompleted, this, &MainWindow::handleImportResult);
+        connect(importThread, &QThread::finished, importWorker, &QObject::deleteLater);
+        connect(importThread, &QThread::finished, importThread, &QObject::deleteLater);
+        connect(importThread, &QThread::started, importWorker, &ImportWorker::doImport);
+
+        // Start import
+        importThread->start();
     }
 }
 
@@ -711,6 +725,18 @@ void MainWindow::showEvent(QShowEvent* event)
     mWindowTaskbarButton->setWindow(this->windowHandle());
 }
 
+void MainWindow::closeEvent(QCloseEvent* event)
+{
+    // A running import must get to revert its changes, so don't close underneath it
+    if(mImportThread)
+    {
+        QMessageBox::warning(this, QApplication::applicationName(), MSG_IMPORT_IN_PROGRESS);
+        event->ignore();
+    }
+    else
+        QMainWindow::closeEvent(event);
+}
+
 //-Slots---------------------------------------------------------------------------------------------------------
 //Private:
 void MainWindow::all_on_action_triggered()
@@ -941,9 +967,29 @@ void MainWindow::handleBlockingError(std::shared_ptr<int> response, Qx::GenericE
         *response = userChoice;
 }
 
+void MainWindow::handleImportCanceled()
+{
+    // Ignore further progress, the worker only stops once it reaches a point where it checks for cancellation
+    disconnect(mImportWorker, nullptr, mImportProgressDialog.get(), nullptr);
+    disconnect(mImportWorker, nullptr, mWindowTaskbarButton->progress(), nullptr);
+
+    // Keep the window blocked until the worker has stopped (canceling hides the dialog)
+    mImportProgressDialog->setLabelText(STEP_CANCELING);
+    mImportProgressDialog->setCancelButton(nullptr);
+    mImportProgressDialog->show();
+}
+
 void MainWindow::handleImportResult(ImportWorker::ImportResult importResult, Qx::GenericError errorReport)
 {
-    // Close progress dialog and reset taskbar progress indicator
+    // Wait for the import thread to wind down, it and the worker clean themselves up once finished
+    mImportThread->quit();
+    mImportThread->wait();
+    mImportThread = nullptr;
+    mImportWorker = nullptr;
+    refreshWidgetEnableStates();
+
+    // Close progress dialog without it reporting a cancel and reset taskbar progress indicator
+    disconnect(mImportProgressDialog.get(), &QProgressDialog::canceled, nullptr, nullptr);
     mImportProgressDialog->close();
     mWindowTaskbarButton->progress()->reset();
     mWindowTaskbarButton->progress()->setVisible(false);
@@ -976,8 +1022,13 @@ void MainWindow::handleImportResult(ImportWorker::ImportResult importResult, Qx:
                     break;
         }
 
-        // Post-import message
-        QMessageBox::information(this, QApplication::applicationName(), MSG_POST_IMPORT);
+        // Post-import message, noting how images were copied if any were (counts are reset by every import)
+        QString postImportMessage = MSG_POST_IMPORT;
+        LB::Install::ImageCopyCounts imageCopyCounts = mLaunchBoxInstall->getImageCopyCounts();
+        if(imageCopyCounts.cloned + imageCopyCounts.copied > 0)
+            postImportMessage += MSG_POST_IMPORT_IMAGE_COPIES.arg(imageCopyCounts.cloned + imageCopyCounts.copied).arg(imageCopyCounts.cloned).arg(imageCopyCounts.copied);
+
+        QMessageBox::information(this, QApplication::applicationName(), postImportMessage);
 
         // Update selection lists to reflect newly existing platforms
         gatherInstallInfo();
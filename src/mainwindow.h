@@ -4,6 +4,7 @@
 #include <QMainWindow>
 #include <QListWidgetItem>
 #include <QProgressDialog>
+#include <QThread>
 #include <QMessageBox>
 #include <QWinTaskbarButton>
 #include <QWinTaskbarProgress>
@@ -73,6 +74,12 @@ private:
                                                       "amount of overhead when it loads images and require almost no extra disk space to store.<br>"
                                                       "<b>Space Consumption:</b> Near-zero<br>"
                                                       "<b>Import Speed:</b> Slow<br>"
+                                                      "<b>Image Cache Build Speed:</b> Fast<br>"
+                                                      "<br>"
+                                                      "<b>%4</b> - A hard link to each relavent image from Flashpoint will be created in your LaunchBox installation. These are real files to LaunchBox that share their storage with the "
+                                                      "originals and need no special permissions, but can only be made when both installs are on the same drive; otherwise the images are copied instead.<br>"
+                                                      "<b>Space Consumption:</b> Near-zero (High if copied)<br>"
+                                                      "<b>Import Speed:</b> Slow<br>"
                                                       "<b>Image Cache Build Speed:</b> Fast<br>";
 
     // Messages - Input
@@ -92,8 +99,10 @@ private:
     static inline const QString MSG_POST_IMPORT = "The Flashpoint import has completed succesfully. Next time you start LaunchBox it may take longer than usual as it will have to fill in some default fields for the imported Platforms/Playlists.\n"
                                                   "\n"
                                                   "If you wish to import further selections or update to a newer version of Flashpoint, simply re-run this procedure after pointing it to the desired Flashpoint installation.";
+    static inline const QString MSG_POST_IMPORT_IMAGE_COPIES = "\n\nImages copied: %1 (%2 by block cloning, %3 by full copy).";
     // Initial import status
     static inline const QString STEP_FP_DB_INITIAL_QUERY = "Making initial Flashpoint database queries...";
+    static inline const QString STEP_CANCELING = "Canceling import, waiting for work in progress to stop...";
 
     // Messages - FP General
     static inline const QString MSG_FP_CLOSE_PROMPT = "It is strongly recommended to close Flashpoint before proceeding as it can severely slow or interfer with the import process";
@@ -129,6 +138,7 @@ private:
                                                      "\n"
                                                      "If you beleive this to be due to a bug with this software, please submit an issue to its GitHub page (listed under help)";
 
+    static inline const QString MSG_IMPORT_IN_PROGRESS = "An import is still in progress and must finish or be canceled before the importer can be closed.";
     static inline const QString MSG_USER_CANCELED = "Import canceled by user, all changes that occured during import will now be reverted (other than existing images that were replaced with newer versions).";
 
     // Dialog captions
@@ -173,6 +183,8 @@ private:
 
     // Process monitoring
     std::unique_ptr<QProgressDialog> mImportProgressDialog;
+    QThread* mImportThread = nullptr; // Set while an import is running
+    ImportWorker* mImportWorker = nullptr;
     QWinTaskbarButton* mWindowTaskbarButton; // TODO: Remove for Qt6
 
     //QTimer mUIUpdateWorkaroundTimer;
@@ -223,6 +235,7 @@ private:
 
 protected:
     void showEvent(QShowEvent* event);
+    void closeEvent(QCloseEvent* event);
 
 //-Slots---------------------------------------------------------------------------------------------------------
 private slots:
@@ -241,6 +254,7 @@ private slots:
 
     // Import Error Handling
     void handleBlockingError(std::shared_ptr<int> response, Qx::GenericError blockingError, QMessageBox::StandardButtons choices);
+    void handleImportCanceled();
     void handleImportResult(ImportWorker::ImportResult importResult, Qx::GenericError errorReport);
 };
 